@@ -0,0 +1,70 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <vector>
+#include <random>
+#include <memory>
+#include <algorithm>
+
+namespace {
+
+struct Fixture {
+    skip_list<int> list;
+    std::vector<int> probes;
+
+    explicit Fixture(std::size_t size) : probes(1 << 12) {
+        std::vector<int> keys(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            keys[i] = static_cast<int>(i * 2);
+        }
+        std::mt19937 g(42);
+        std::shuffle(keys.begin(), keys.end(), g);
+        for (int key : keys) {
+            list.insert(key);
+        }
+        for (int& probe : probes) {
+            probe = static_cast<int>(g() % (size * 2));
+        }
+    }
+};
+
+void BM_ContainsLoop(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    std::unique_ptr<bool[]> found(new bool[f.probes.size()]);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < f.probes.size(); ++i) {
+            found[i] = f.list.contains(f.probes[i]);
+        }
+        benchmark::DoNotOptimize(found.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(f.probes.size()));
+}
+
+void BM_ContainsBatch(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    std::unique_ptr<bool[]> found(new bool[f.probes.size()]);
+    for (auto _ : state) {
+        f.list.contains_batch(f.probes, std::span<bool>(found.get(), f.probes.size()));
+        benchmark::DoNotOptimize(found.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(f.probes.size()));
+}
+
+void BM_ContainsBatchSorted(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    std::sort(f.probes.begin(), f.probes.end());
+    std::unique_ptr<bool[]> found(new bool[f.probes.size()]);
+    for (auto _ : state) {
+        f.list.contains_batch(f.probes, std::span<bool>(found.get(), f.probes.size()));
+        benchmark::DoNotOptimize(found.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(f.probes.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ContainsLoop)->Range(1 << 10, 1 << 21);
+BENCHMARK(BM_ContainsBatch)->Range(1 << 10, 1 << 21);
+BENCHMARK(BM_ContainsBatchSorted)->Range(1 << 10, 1 << 21);
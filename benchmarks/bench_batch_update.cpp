@@ -0,0 +1,83 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <vector>
+#include <random>
+
+namespace {
+
+constexpr int base_size = 1 << 20;
+
+/// A list of `base_size` even keys and a batch of `batch` random odd keys to ingest.
+struct Fixture {
+    skip_list<int> list;
+    std::vector<int> batch;
+
+    explicit Fixture(std::size_t batch_size) : batch(batch_size) {
+        std::vector<int> keys(base_size);
+        for (int i = 0; i < base_size; ++i) {
+            keys[static_cast<std::size_t>(i)] = i * 2;
+        }
+        list.insert_sorted(keys.begin(), keys.end());
+        std::mt19937 g(42);
+        for (int& key : batch) {
+            key = static_cast<int>(g() % base_size) * 2 + 1;
+        }
+    }
+};
+
+void BM_InsertLoop(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int key : f.batch) {
+            f.list.insert(key);
+        }
+        state.PauseTiming();
+        for (int key : f.batch) {
+            f.list.erase(key);
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InsertBatch(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        f.list.insert_batch(f.batch);
+        state.PauseTiming();
+        f.list.erase_batch(f.batch);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EraseLoop(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        f.list.insert_batch(f.batch);
+        state.ResumeTiming();
+        for (int key : f.batch) {
+            f.list.erase(key);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EraseBatch(benchmark::State& state) {
+    Fixture f(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        f.list.insert_batch(f.batch);
+        state.ResumeTiming();
+        f.list.erase_batch(f.batch);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_InsertLoop)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_InsertBatch)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_EraseLoop)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_EraseBatch)->Arg(1000)->Arg(10000);
@@ -0,0 +1,122 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <vector>
+#include <numeric>
+
+namespace {
+
+std::vector<int> sorted_keys(std::size_t count) {
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 0);
+    return keys;
+}
+
+void BM_BuildByInsert(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list;
+        for (int key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BuildFromSortedRange(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BuildBalanced(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list;
+        list.insert_sorted(keys.begin(), keys.end(), tower_heights::balanced);
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Rebuilding a list from the elements of another one, as a pipeline stage had to before copies existed.
+void BM_RebuildFromList(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> source(keys.begin(), keys.end());
+    for (auto _ : state) {
+        skip_list<int> list;
+        for (int key : source) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CopyList(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> source(keys.begin(), keys.end());
+    for (auto _ : state) {
+        skip_list<int> list(source);
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MoveList(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    skip_list<int> a(keys.begin(), keys.end());
+    skip_list<int> b;
+    for (auto _ : state) {
+        b = std::move(a);
+        a = std::move(b);
+        benchmark::DoNotOptimize(a.size());
+    }
+}
+
+/// Halving a list by copying the upper half out and erasing it, then appending it back.
+void BM_SplitByCopy(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    const int mid = static_cast<int>(keys.size() / 2);
+    skip_list<int> list(keys.begin(), keys.end());
+    for (auto _ : state) {
+        skip_list<int> tail;
+        tail.insert_sorted(list.lower_bound(mid), list.end());
+        list.erase(list.lower_bound(mid), list.end());
+        for (int key : tail) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+
+template<typename Traits>
+void BM_SplitAndConcat(benchmark::State& state) {
+    const auto keys = sorted_keys(static_cast<std::size_t>(state.range(0)));
+    const int mid = static_cast<int>(keys.size() / 2);
+    skip_list<int, std::less<int>, std::allocator<int>, Traits> list(keys.begin(), keys.end());
+    for (auto _ : state) {
+        auto tail = list.split_at(mid);
+        list.concat(std::move(tail));
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+
+struct indexed_traits : skip_list_traits {
+    static constexpr bool indexed = true;
+};
+
+} // namespace
+
+BENCHMARK(BM_BuildByInsert)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_BuildFromSortedRange)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_BuildBalanced)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_RebuildFromList)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_CopyList)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MoveList)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_SplitByCopy)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SplitAndConcat, skip_list_traits)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SplitAndConcat, indexed_traits)->Range(1 << 10, 1 << 20);
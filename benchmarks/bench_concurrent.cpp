@@ -0,0 +1,115 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "concurrent_skip_list.hpp"
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace {
+
+constexpr int key_range = 1 << 16;
+
+/**
+ * @brief The previous way of sharing a list between threads: one mutex around a skip_list.
+ */
+class locked_skip_list {
+    std::mutex mutex_;
+    skip_list<int> list_;
+
+public:
+    bool insert(int key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.insert(key);
+    }
+
+    bool erase(int key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.erase(key);
+    }
+
+    bool contains(int key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.contains(key);
+    }
+};
+
+struct concurrent_reader_traits : skip_list_traits {
+    static constexpr bool concurrent_readers = true;
+};
+
+/// One writer and lock-free readers on a plain skip_list.
+using rcu_skip_list = skip_list<int, std::less<int>, std::allocator<int>, concurrent_reader_traits>;
+
+template<typename List>
+std::unique_ptr<List> shared_list;
+
+template<typename List>
+void fill_shared_list() {
+    shared_list<List> = std::make_unique<List>();
+    std::mt19937 g(42);
+    for (int i = 0; i < key_range / 2; ++i) {
+        shared_list<List>->insert(static_cast<int>(g() % key_range));
+    }
+}
+
+/**
+ * @brief Every thread runs the same mix on one shared list: 90% lookups, 5% inserts, 5% erasures.
+ */
+template<typename List>
+void BM_Mixed(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        fill_shared_list<List>();
+    }
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()) + 1);
+    for (auto _ : state) {
+        List& list = *shared_list<List>;
+        const unsigned draw = rng();
+        const int key = static_cast<int>(draw % key_range);
+        const unsigned op = (draw >> 20) % 20;
+        if (op == 0) {
+            benchmark::DoNotOptimize(list.insert(key));
+        } else if (op == 1) {
+            benchmark::DoNotOptimize(list.erase(key));
+        } else {
+            benchmark::DoNotOptimize(list.contains(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        shared_list<List>.reset();
+    }
+}
+
+/**
+ * @brief Thread 0 keeps inserting and erasing; every other thread only looks keys up.
+ *        Only lookups are counted.
+ */
+template<typename List>
+void BM_SingleWriter(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        fill_shared_list<List>();
+    }
+    const bool writer = state.thread_index() == 0 && state.threads() > 1;
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()) + 1);
+    for (auto _ : state) {
+        List& list = *shared_list<List>;
+        const int key = static_cast<int>(rng() % key_range);
+        if (writer) {
+            benchmark::DoNotOptimize(list.insert(key) || list.erase(key));
+        } else {
+            benchmark::DoNotOptimize(list.contains(key));
+        }
+    }
+    state.SetItemsProcessed(writer ? 0 : state.iterations());
+    if (state.thread_index() == 0) {
+        shared_list<List>.reset();
+    }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Mixed, locked_skip_list)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mixed, concurrent_skip_list<int>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SingleWriter, locked_skip_list)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SingleWriter, rcu_skip_list)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SingleWriter, concurrent_skip_list<int>)->ThreadRange(1, 16)->UseRealTime();
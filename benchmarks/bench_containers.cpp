@@ -0,0 +1,282 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "stress_harness.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// The largest element count benchmarked; sizes run from 1K up in powers of 10 (100M needs tens of GB).
+#ifndef SKIP_LIST_BENCH_MAX_ELEMENTS
+#define SKIP_LIST_BENCH_MAX_ELEMENTS 1000000
+#endif
+
+namespace {
+
+/// The order in which a benchmark touches the keys; the second benchmark argument.
+enum class key_pattern : int {
+    sequential, ///< Ascending key order.
+    random,     ///< Every key once, in a random order.
+    zipfian     ///< Keys drawn with Zipf(0.99) popularity, the hot ones scattered over the key space.
+};
+
+constexpr const char* pattern_names[] = {"sequential", "random", "zipfian"};
+
+using stress::zipfian_generator;
+
+/// Returns the positions in [0, n) a benchmark visits, in the order of `pattern`.
+std::vector<std::uint64_t> key_order(std::uint64_t n, key_pattern pattern) {
+    std::vector<std::uint64_t> order(n);
+    switch (pattern) {
+    case key_pattern::sequential:
+        std::iota(order.begin(), order.end(), std::uint64_t{0});
+        break;
+    case key_pattern::random:
+        std::iota(order.begin(), order.end(), std::uint64_t{0});
+        std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+        break;
+    case key_pattern::zipfian: {
+        const std::uint64_t scatter = stress::scatter_multiplier(n);
+        zipfian_generator zipf(n, 0.99, 42);
+        for (std::uint64_t& position : order) {
+            position = zipf() * scatter % n;
+        }
+        break;
+    }
+    }
+    return order;
+}
+
+/// The key at a position: strictly increasing in the position for every key type.
+template<typename Key>
+Key make_key(std::uint64_t position) {
+    if constexpr (std::is_same_v<Key, std::string>) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "user:%016llu", static_cast<unsigned long long>(position));
+        return buffer;
+    } else if constexpr (std::is_same_v<Key, std::uint64_t>) {
+        return position * 0x10001 + 0x5bd1;
+    } else {
+        return static_cast<Key>(position);
+    }
+}
+
+template<typename Key>
+std::vector<Key> sorted_keys(std::uint64_t n) {
+    std::vector<Key> keys;
+    keys.reserve(n);
+    for (std::uint64_t i = 0; i < n; ++i) {
+        keys.push_back(make_key<Key>(i));
+    }
+    return keys;
+}
+
+template<typename Key>
+std::vector<Key> ordered_keys(std::uint64_t n, key_pattern pattern) {
+    std::vector<Key> keys;
+    keys.reserve(n);
+    for (std::uint64_t position : key_order(n, pattern)) {
+        keys.push_back(make_key<Key>(position));
+    }
+    return keys;
+}
+
+/// @brief The sorted-array baseline for lookups and iteration; it has no efficient insert or erase.
+template<typename Key>
+class sorted_vector_set {
+    std::vector<Key> keys_;
+
+public:
+    using value_type = Key;
+
+    template<typename InputIt>
+    sorted_vector_set(InputIt first, InputIt last) : keys_(first, last) {
+        std::sort(keys_.begin(), keys_.end());
+        keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+    }
+
+    bool contains(const Key& key) const { return std::binary_search(keys_.begin(), keys_.end(), key); }
+
+    typename std::vector<Key>::const_iterator find(const Key& key) const {
+        const auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+        return it != keys_.end() && !(key < *it) ? it : keys_.end();
+    }
+
+    typename std::vector<Key>::const_iterator begin() const { return keys_.begin(); }
+    typename std::vector<Key>::const_iterator end() const { return keys_.end(); }
+};
+
+key_pattern pattern_of(benchmark::State& state) {
+    const auto pattern = static_cast<key_pattern>(state.range(1));
+    state.SetLabel(pattern_names[state.range(1)]);
+    return pattern;
+}
+
+template<typename Set>
+void BM_Insert(benchmark::State& state) {
+    using key_type = typename Set::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    const std::vector<key_type> keys = ordered_keys<key_type>(n, pattern_of(state));
+    for (auto _ : state) {
+        std::optional<Set> set(std::in_place);
+        for (const key_type& key : keys) {
+            set->insert(key);
+        }
+        benchmark::DoNotOptimize(set->begin());
+        state.PauseTiming();
+        set.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Set>
+void BM_Erase(benchmark::State& state) {
+    using key_type = typename Set::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    const std::vector<key_type> all = sorted_keys<key_type>(n);
+    const std::vector<key_type> keys = ordered_keys<key_type>(n, pattern_of(state));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::optional<Set> set(std::in_place, all.begin(), all.end());
+        state.ResumeTiming();
+        for (const key_type& key : keys) {
+            set->erase(key);
+        }
+        benchmark::DoNotOptimize(set->begin());
+        state.PauseTiming();
+        set.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Set>
+void BM_Contains(benchmark::State& state) {
+    using key_type = typename Set::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    const std::vector<key_type> all = sorted_keys<key_type>(n);
+    const std::vector<key_type> keys = ordered_keys<key_type>(n, pattern_of(state));
+    const Set set(all.begin(), all.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.contains(keys[i]));
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Set>
+void BM_Find(benchmark::State& state) {
+    using key_type = typename Set::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    const std::vector<key_type> all = sorted_keys<key_type>(n);
+    const std::vector<key_type> keys = ordered_keys<key_type>(n, pattern_of(state));
+    const Set set(all.begin(), all.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto it = set.find(keys[i]);
+        benchmark::DoNotOptimize(it != set.end() ? &*it : nullptr);
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Set>
+void BM_Iterate(benchmark::State& state) {
+    using key_type = typename Set::value_type;
+    const std::vector<key_type> all = sorted_keys<key_type>(static_cast<std::uint64_t>(state.range(0)));
+    const Set set(all.begin(), all.end());
+    for (auto _ : state) {
+        std::size_t visited = 0;
+        for (const key_type& key : set) {
+            benchmark::DoNotOptimize(&key);
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sizes_and_patterns(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"elements", "pattern"});
+    for (std::int64_t n = 1000; n <= SKIP_LIST_BENCH_MAX_ELEMENTS; n *= 10) {
+        for (int pattern = 0; pattern < 3; ++pattern) {
+            b->Args({n, pattern});
+        }
+    }
+}
+
+void sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("elements");
+    for (std::int64_t n = 1000; n <= SKIP_LIST_BENCH_MAX_ELEMENTS; n *= 10) {
+        b->Arg(n);
+    }
+}
+
+using u64 = std::uint64_t;
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Insert, skip_list<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::unordered_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, skip_list<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::unordered_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, skip_list<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::unordered_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, sorted_vector_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, skip_list<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::unordered_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, sorted_vector_set<int>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Iterate, skip_list<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::unordered_set<int>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sorted_vector_set<int>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Insert, skip_list<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::unordered_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, skip_list<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::unordered_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, skip_list<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::unordered_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, sorted_vector_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, skip_list<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::unordered_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, sorted_vector_set<u64>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Iterate, skip_list<u64>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<u64>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::unordered_set<u64>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sorted_vector_set<u64>)->Apply(sizes);
+
+BENCHMARK_TEMPLATE(BM_Insert, skip_list<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Insert, std::unordered_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, skip_list<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Erase, std::unordered_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, skip_list<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, std::unordered_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Contains, sorted_vector_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, skip_list<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, std::unordered_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Find, sorted_vector_set<std::string>)->Apply(sizes_and_patterns);
+BENCHMARK_TEMPLATE(BM_Iterate, skip_list<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, std::unordered_set<std::string>)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Iterate, sorted_vector_set<std::string>)->Apply(sizes);
@@ -0,0 +1,67 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <vector>
+#include <random>
+#include <algorithm>
+
+namespace {
+
+struct LastAccessTraits : skip_list_traits {
+    static constexpr bool last_access_finger = true;
+};
+
+/// Ascending keys with short local shuffles, the typical shape of time-ordered ingest.
+std::vector<int> nearly_sorted_keys(std::size_t count) {
+    std::vector<int> keys(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys[i] = static_cast<int>(i);
+    }
+    std::mt19937 g(42);
+    for (std::size_t i = 0; i + 8 <= count; i += 8) {
+        std::shuffle(keys.begin() + i, keys.begin() + i + 8, g);
+    }
+    return keys;
+}
+
+void BM_InsertNearlySorted(benchmark::State& state) {
+    const auto keys = nearly_sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list;
+        for (int key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InsertNearlySortedWithFinger(benchmark::State& state) {
+    const auto keys = nearly_sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list;
+        skip_list<int>::finger hint;
+        for (int key : keys) {
+            list.insert(hint, key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InsertNearlySortedLastAccess(benchmark::State& state) {
+    const auto keys = nearly_sorted_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int, std::less<int>, std::allocator<int>, LastAccessTraits> list;
+        for (int key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_InsertNearlySorted)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_InsertNearlySortedWithFinger)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_InsertNearlySortedLastAccess)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,92 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "frozen_skip_list.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int> random_keys(std::size_t count) {
+    std::mt19937 g(7);
+    std::vector<int> keys(count);
+    for (int& key : keys) {
+        key = static_cast<int>(g() >> 1);
+    }
+    return keys;
+}
+
+/// Probes random keys, half of them present.
+template<typename Contains>
+void probe(benchmark::State& state, const std::vector<int>& keys, Contains contains) {
+    std::mt19937 g(3);
+    for (auto _ : state) {
+        const int key = g() & 1 ? keys[g() % keys.size()] : static_cast<int>(g() >> 1);
+        benchmark::DoNotOptimize(contains(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LookupLinked(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> list(keys.begin(), keys.end());
+    probe(state, keys, [&list](int key) { return list.contains(key); });
+}
+
+void BM_LookupFrozen(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const frozen_skip_list<int> frozen = skip_list<int>(keys.begin(), keys.end()).freeze();
+    probe(state, keys, [&frozen](int key) { return frozen.contains(key); });
+}
+
+/// The reference: std::binary_search over a sorted array.
+void BM_LookupSortedArray(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    probe(state, keys, [&sorted](int key) { return std::binary_search(sorted.begin(), sorted.end(), key); });
+}
+
+void BM_ScanLinked(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> list(keys.begin(), keys.end());
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int key : list) {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ScanFrozen(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const frozen_skip_list<int> frozen = skip_list<int>(keys.begin(), keys.end()).freeze();
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int key : frozen) {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Freeze(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> list(keys.begin(), keys.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.freeze().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_LookupLinked)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_LookupFrozen)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_LookupSortedArray)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_ScanLinked)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScanFrozen)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Freeze)->Range(1 << 10, 1 << 20);
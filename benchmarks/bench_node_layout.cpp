@@ -0,0 +1,169 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <vector>
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+namespace {
+
+struct statistics_traits : skip_list_traits {
+    static constexpr bool statistics = true;
+};
+
+/// The list with the search counters compiled in, to price the instrumentation.
+using instrumented_list = skip_list<int, std::less<int>, std::allocator<int>, statistics_traits>;
+
+/**
+ * @brief Reference copy of the previous node layout, where every node owns a
+ *        `std::vector` of forward pointers (two allocations per node and an extra
+ *        indirection per level hop).
+ */
+template<typename KeyType>
+class vector_tower_list {
+    struct SkipNode {
+        KeyType value;
+        std::vector<SkipNode*> forward;
+
+        SkipNode(int level, const KeyType& val) : value(val), forward(level, nullptr) {}
+    };
+
+    static constexpr int MAX_HEIGHT = 16;
+
+    SkipNode* sentinel_head_;
+    int current_height_;
+    std::mt19937 random_engine_;
+    std::uniform_real_distribution<float> distribution_;
+
+    int generateRandomHeight() {
+        int height = 1;
+        while (distribution_(random_engine_) < 0.5f && height < MAX_HEIGHT) {
+            ++height;
+        }
+        return height;
+    }
+
+public:
+    vector_tower_list()
+        : sentinel_head_(new SkipNode(MAX_HEIGHT, KeyType{})),
+          current_height_(0),
+          random_engine_(std::random_device{}()),
+          distribution_(0.0f, 1.0f) {}
+
+    ~vector_tower_list() {
+        SkipNode* current = sentinel_head_;
+        while (current) {
+            SkipNode* next = current->forward[0];
+            delete current;
+            current = next;
+        }
+    }
+
+    bool insert(const KeyType& value) {
+        std::vector<SkipNode*> update_path(MAX_HEIGHT, nullptr);
+        SkipNode* current = sentinel_head_;
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (current->forward[i] && current->forward[i]->value < value) {
+                current = current->forward[i];
+            }
+            update_path[i] = current;
+        }
+        current = current->forward[0];
+        if (current && current->value == value) {
+            return false;
+        }
+        int newHeight = generateRandomHeight();
+        if (newHeight > current_height_) {
+            for (int i = current_height_; i < newHeight; ++i) {
+                update_path[i] = sentinel_head_;
+            }
+            current_height_ = newHeight;
+        }
+        SkipNode* newNode = new SkipNode(newHeight, value);
+        for (int i = 0; i < newHeight; ++i) {
+            newNode->forward[i] = update_path[i]->forward[i];
+            update_path[i]->forward[i] = newNode;
+        }
+        return true;
+    }
+
+    bool contains(const KeyType& value) const {
+        SkipNode* current = sentinel_head_;
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (current->forward[i] && current->forward[i]->value < value) {
+                current = current->forward[i];
+            }
+        }
+        current = current->forward[0];
+        return current && current->value == value;
+    }
+};
+
+std::vector<int> shuffled_keys(std::size_t count) {
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937 g(42);
+    std::shuffle(keys.begin(), keys.end(), g);
+    return keys;
+}
+
+template<typename List>
+void BM_Insert(benchmark::State& state) {
+    const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List list;
+        for (int key : keys) {
+            list.insert(key);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename List>
+void BM_Contains(benchmark::State& state) {
+    const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+    List list;
+    for (int key : keys) {
+        list.insert(key);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.contains(keys[i]));
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+struct level_counts_traits : skip_list_traits {
+    static constexpr bool level_counts = true;
+};
+
+/// The cost of reading the memory metrics; the bytes per element are reported as counters.
+void BM_MemoryUsage(benchmark::State& state) {
+    const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+    skip_list<int, std::less<int>, std::allocator<int>, level_counts_traits> list;
+    for (int key : keys) {
+        list.insert(key);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.memory_usage());
+        benchmark::DoNotOptimize(list.level_histogram());
+    }
+    const skip_list_memory_usage usage = list.memory_usage();
+    const auto per_element = [&list](std::size_t bytes) {
+        return static_cast<double>(bytes) / static_cast<double>(list.size());
+    };
+    state.counters["node_bytes"] = per_element(usage.nodes);
+    state.counters["tower_bytes"] = per_element(usage.towers);
+    state.counters["slack_bytes"] = per_element(usage.slack);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Insert, vector_tower_list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Insert, skip_list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Contains, vector_tower_list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Contains, skip_list<int>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Contains, instrumented_list)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MemoryUsage)->Range(1 << 10, 1 << 20);
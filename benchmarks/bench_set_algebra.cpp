@@ -0,0 +1,87 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int worker_count = 8;
+
+/// Per-worker lists with interleaved keys, as produced by hash-partitioned workers.
+std::vector<skip_list<int>> worker_lists(int per_worker) {
+    std::vector<skip_list<int>> lists(worker_count);
+    for (int i = 0; i < per_worker * worker_count; ++i) {
+        lists[static_cast<std::size_t>(i % worker_count)].insert(i);
+    }
+    return lists;
+}
+
+skip_list<int> random_list(std::size_t size, unsigned seed) {
+    std::mt19937 g(seed);
+    skip_list<int> list;
+    while (list.size() < size) {
+        list.insert(static_cast<int>(g() % (1 << 24)));
+    }
+    return list;
+}
+
+void BM_CombineByInsert(benchmark::State& state) {
+    const int per_worker = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<skip_list<int>> lists = worker_lists(per_worker);
+        state.ResumeTiming();
+        skip_list<int> global;
+        for (const skip_list<int>& list : lists) {
+            for (int key : list) {
+                global.insert(key);
+            }
+        }
+        benchmark::DoNotOptimize(global.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * worker_count);
+}
+
+void BM_CombineByMerge(benchmark::State& state) {
+    const int per_worker = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<skip_list<int>> lists = worker_lists(per_worker);
+        state.ResumeTiming();
+        skip_list<int> global;
+        for (skip_list<int>& list : lists) {
+            global.merge(list);
+        }
+        benchmark::DoNotOptimize(global.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * worker_count);
+}
+
+/// Intersects a list of 1M keys with one of `range(0)` keys.
+void BM_IntersectLinear(benchmark::State& state) {
+    const skip_list<int> large = random_list(1 << 20, 1);
+    const skip_list<int> small = random_list(static_cast<std::size_t>(state.range(0)), 2);
+    for (auto _ : state) {
+        std::vector<int> out;
+        std::set_intersection(small.begin(), small.end(), large.begin(), large.end(), std::back_inserter(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+void BM_IntersectGalloping(benchmark::State& state) {
+    const skip_list<int> large = random_list(1 << 20, 1);
+    const skip_list<int> small = random_list(static_cast<std::size_t>(state.range(0)), 2);
+    for (auto _ : state) {
+        skip_list<int> out = set_intersection(small, large);
+        benchmark::DoNotOptimize(out.size());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_CombineByInsert)->Range(1 << 10, 1 << 17);
+BENCHMARK(BM_CombineByMerge)->Range(1 << 10, 1 << 17);
+BENCHMARK(BM_IntersectLinear)->Range(1 << 4, 1 << 16);
+BENCHMARK(BM_IntersectGalloping)->Range(1 << 4, 1 << 16);
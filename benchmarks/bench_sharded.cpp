@@ -0,0 +1,109 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "sharded_skip_list.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace {
+
+constexpr int key_count = 1 << 20;
+
+using sharded_list = sharded_skip_list<int, 64>;
+
+/// Runs every task on the calling thread: the scan cost without any parallelism.
+struct inline_executor {
+    template<typename Task>
+    void operator()(Task task) const { task(); }
+};
+
+sharded_list& scan_fixture() {
+    static const std::unique_ptr<sharded_list> list = [] {
+        auto built = std::make_unique<sharded_list>(key_count / 64);
+        for (int i = 0; i < key_count; ++i) {
+            built->insert(i);
+        }
+        return built;
+    }();
+    return *list;
+}
+
+void BM_ScanSingleList(benchmark::State& state) {
+    skip_list<int> list;
+    for (int i = 0; i < key_count; ++i) {
+        list.insert(i);
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = list.lower_bound(0); it != list.end(); ++it) {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+void BM_ScanShardsInline(benchmark::State& state) {
+    const sharded_list& list = scan_fixture();
+    for (auto _ : state) {
+        std::atomic<long long> sum{0};
+        list.for_each_range(0, key_count, [&sum](int key) { sum.fetch_add(key, std::memory_order_relaxed); },
+                            inline_executor{});
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+void BM_ScanShardsParallel(benchmark::State& state) {
+    const sharded_list& list = scan_fixture();
+    for (auto _ : state) {
+        std::atomic<long long> sum{0};
+        list.for_each_range(0, key_count, [&sum](int key) { sum.fetch_add(key, std::memory_order_relaxed); });
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+std::unique_ptr<sharded_list> shared_sharded;
+std::unique_ptr<std::pair<std::mutex, skip_list<int>>> shared_locked;
+
+/// Every thread inserts and erases random keys on one shared list.
+void BM_UpdatesSharded(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        shared_sharded = std::make_unique<sharded_list>(1 << 10);
+    }
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()) + 1);
+    for (auto _ : state) {
+        const int key = static_cast<int>(rng() % key_count);
+        benchmark::DoNotOptimize(shared_sharded->insert(key) || shared_sharded->erase(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        shared_sharded.reset();
+    }
+}
+
+void BM_UpdatesLocked(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        shared_locked = std::make_unique<std::pair<std::mutex, skip_list<int>>>();
+    }
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()) + 1);
+    for (auto _ : state) {
+        const int key = static_cast<int>(rng() % key_count);
+        std::lock_guard<std::mutex> lock(shared_locked->first);
+        benchmark::DoNotOptimize(shared_locked->second.insert(key) || shared_locked->second.erase(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        shared_locked.reset();
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ScanSingleList)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScanShardsInline)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScanShardsParallel)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_UpdatesLocked)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_UpdatesSharded)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,94 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "skip_list_view.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+const std::string image_path = "/tmp/bench_snapshot_" + std::to_string(::getpid()) + ".img";
+
+std::vector<int> random_keys(std::size_t count) {
+    std::mt19937 g(17);
+    std::vector<int> keys(count);
+    for (int& key : keys) {
+        key = static_cast<int>(g() >> 1);
+    }
+    return keys;
+}
+
+/// Saves a list of `count` random keys to image_path once per size.
+void save_fixture(std::size_t count) {
+    static std::size_t saved = 0;
+    if (saved == count) {
+        return;
+    }
+    const auto keys = random_keys(count);
+    const skip_list<int> list(keys.begin(), keys.end());
+    const int fd = ::open(image_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    save_image(list, fd);
+    ::close(fd);
+    saved = count;
+}
+
+/// Restarting by re-inserting every key, as a service did before images existed.
+void BM_StartupByInsert(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<int> list;
+        for (int key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+
+void BM_StartupByMapping(benchmark::State& state) {
+    save_fixture(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        const skip_list_view<int> view(image_path);
+        benchmark::DoNotOptimize(view.contains(42));
+    }
+}
+
+void BM_SaveImage(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    const skip_list<int> list(keys.begin(), keys.end());
+    for (auto _ : state) {
+        std::size_t bytes = 0;
+        list.save([&bytes](const char*, std::size_t size) { bytes += size; });
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Set>
+void lookups(benchmark::State& state, const Set& set) {
+    std::mt19937 g(3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.contains(static_cast<int>(g() >> 1)));
+    }
+}
+
+void BM_LookupList(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+    lookups(state, skip_list<int>(keys.begin(), keys.end()));
+}
+
+void BM_LookupView(benchmark::State& state) {
+    save_fixture(static_cast<std::size_t>(state.range(0)));
+    lookups(state, skip_list_view<int>(image_path));
+}
+
+} // namespace
+
+BENCHMARK(BM_StartupByInsert)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StartupByMapping)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SaveImage)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_LookupList)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_LookupView)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,102 @@
+#include "benchmark/benchmark.h"
+#include "skip_list.hpp"
+#include "unrolled_skip_list.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+template<typename Key>
+std::vector<Key> random_keys(std::size_t count) {
+    std::mt19937_64 g(7);
+    std::vector<Key> keys(count);
+    for (Key& key : keys) {
+        key = static_cast<Key>(g() >> 1);
+    }
+    return keys;
+}
+
+/// Probes random keys, half of them present.
+template<typename Key, typename Contains>
+void probe(benchmark::State& state, const std::vector<Key>& keys, Contains contains) {
+    std::mt19937_64 g(3);
+    for (auto _ : state) {
+        const Key key = g() & 1 ? keys[g() % keys.size()] : static_cast<Key>(g() >> 1);
+        benchmark::DoNotOptimize(contains(key));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Key>
+void BM_LookupLinked(benchmark::State& state) {
+    const auto keys = random_keys<Key>(static_cast<std::size_t>(state.range(0)));
+    const skip_list<Key> list(keys.begin(), keys.end());
+    probe(state, keys, [&list](Key key) { return list.contains(key); });
+    state.counters["bytes_per_key"] = static_cast<double>(list.memory_usage().total()) / static_cast<double>(list.size());
+}
+
+template<typename Key>
+void BM_LookupUnrolled(benchmark::State& state) {
+    const auto keys = random_keys<Key>(static_cast<std::size_t>(state.range(0)));
+    unrolled_skip_list<Key> list;
+    for (Key key : keys) {
+        list.insert(key);
+    }
+    probe(state, keys, [&list](Key key) { return list.contains(key); });
+    state.counters["keys_per_block"] = static_cast<double>(list.size()) / static_cast<double>(list.block_count());
+    state.counters["bytes_per_key"] = static_cast<double>(list.memory_usage().total()) / static_cast<double>(list.size());
+}
+
+template<typename Key>
+void BM_InsertLinked(benchmark::State& state) {
+    const auto keys = random_keys<Key>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        skip_list<Key> list;
+        for (Key key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Key>
+void BM_InsertUnrolled(benchmark::State& state) {
+    const auto keys = random_keys<Key>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        unrolled_skip_list<Key> list;
+        for (Key key : keys) {
+            list.insert(key);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Key>
+void BM_ScanUnrolled(benchmark::State& state) {
+    const auto keys = random_keys<Key>(static_cast<std::size_t>(state.range(0)));
+    unrolled_skip_list<Key> list;
+    for (Key key : keys) {
+        list.insert(key);
+    }
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (Key key : list) {
+            sum += static_cast<std::uint64_t>(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_LookupLinked, int)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_LookupUnrolled, int)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_LookupLinked, std::uint64_t)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_LookupUnrolled, std::uint64_t)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_InsertLinked, int)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertUnrolled, int)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ScanUnrolled, int)->Range(1 << 10, 1 << 20);
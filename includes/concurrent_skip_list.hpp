@@ -0,0 +1,722 @@
+/**
+ * @file concurrent_skip_list.hpp
+ * @brief Provides a lock-free ordered set built on CAS-linked skip list towers.
+ *
+ * This file contains the declaration and definition of the concurrent_skip_list class,
+ * which many threads may insert into, erase from and search at the same time.
+ *
+ */
+
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include "skip_list.hpp"
+#include "epoch_domain.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @struct concurrent_skip_list_traits
+ * @brief The default tuning knobs of concurrent_skip_list.
+ *
+ * Identical to skip_list_traits except for the level generator, which must be safe to
+ * call from several threads at once; thread_local_level_generator is stateless.
+ * The finger, indexed and bidirectional options of skip_list_traits are ignored.
+ */
+struct concurrent_skip_list_traits : skip_list_traits {
+    using level_generator = thread_local_level_generator;
+};
+
+/**
+ * @class concurrent_skip_list
+ * @brief A lock-free ordered set of unique keys.
+ *
+ * Towers are linked with compare-and-swap in the style of Herlihy, Lev, Luchangco and
+ * Shavit (after Fraser): every forward link carries a deletion mark in its low bit.
+ * erase() first marks the links of a node top-down, the level-0 mark being the point
+ * at which the key leaves the set, then searches again to unlink it; any search that
+ * meets a marked node helps by unlinking it. insert() publishes a node with one CAS at
+ * level 0 and links the upper levels afterwards, so insert(), erase() and contains()
+ * are all lock-free and contains() never writes shared memory.
+ *
+ * Unlinked nodes are not freed on the spot: they are retired into an epoch_domain and
+ * released once no thread that might still be traversing them remains pinned. Every
+ * operation pins the calling thread for its own duration, and so does every iterator
+ * that is not at the end.
+ *
+ * Iterators are weakly consistent: they never return a key twice or out of order and
+ * always see the keys present for the whole iteration, but may or may not see keys
+ * inserted or erased concurrently. An iterator belongs to the thread that created it.
+ *
+ * The list itself (construction, destruction) is not thread-safe, and size() is exact
+ * only when no mutation is in flight.
+ *
+ * @tparam Key The type of the keys. Keys are immutable once inserted.
+ * @tparam Compare A strict weak ordering on keys. It must be safe to call concurrently.
+ *         If it declares `is_transparent`, lookups accept any type comparable with the key.
+ * @tparam Allocator The allocator node memory is obtained from. It must be safe to call concurrently.
+ * @tparam Traits Compile-time tuning knobs (maximum height, promotion probability,
+ *         level generator), see concurrent_skip_list_traits.
+ */
+template<typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>,
+         typename Traits = concurrent_skip_list_traits>
+class concurrent_skip_list {
+    static_assert(Traits::max_height >= 1 && Traits::max_height <= 64, "max_height must be in [1, 64].");
+    static_assert(Traits::promotion_shift >= 1 && Traits::promotion_shift <= 63, "promotion_shift must be in [1, 63].");
+    static_assert(std::is_invocable_r_v<std::uint64_t, const typename Traits::level_generator&>,
+                  "The level generator of a concurrent_skip_list must be callable through a const reference "
+                  "from several threads, e.g. thread_local_level_generator.");
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+
+    class const_iterator;
+    using iterator = const_iterator; ///< Keys are immutable, so both iterators are read-only.
+
+private:
+    static constexpr int MAX_HEIGHT = Traits::max_height; ///< Defines the maximum possible height for any node.
+    static constexpr int PROMOTION_SHIFT = Traits::promotion_shift; ///< Encodes the promotion probability `1 / 2^PROMOTION_SHIFT`.
+
+    using link = std::atomic<std::uintptr_t>; ///< A forward pointer whose low bit is the deletion mark.
+    using tower_ptr = link*;                  ///< The forward links of a node, or of the head.
+
+    static constexpr std::uintptr_t mark_bit = 1;
+
+    /**
+     * @struct node
+     * @brief A key followed in the same block by its `height` forward links.
+     */
+    struct node : epoch_hook {
+        Key key;
+        int height;
+        /// The inserting thread and the list membership; the node is retired when both are gone.
+        std::atomic<int> owners{2};
+
+        template<typename... Args>
+        explicit node(int level, Args&&... args) : key(std::forward<Args>(args)...), height(level) {}
+
+        /// @brief Returns the forward links stored right after the node.
+        link* next() noexcept { return reinterpret_cast<link*>(this + 1); }
+    };
+
+    /// @brief The unit node blocks are allocated in.
+    struct alignas(node) storage_unit {
+        unsigned char bytes[alignof(node)];
+    };
+
+    using unit_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<storage_unit>;
+    using unit_traits = std::allocator_traits<unit_allocator>;
+    using level_generator = typename Traits::level_generator;
+    using predecessors_type = std::array<tower_ptr, MAX_HEIGHT>;
+    using successors_type = std::array<node*, MAX_HEIGHT>;
+
+    [[no_unique_address]] unit_allocator allocator_; ///< The allocator node blocks are obtained from.
+    [[no_unique_address]] Compare comp_;             ///< The ordering applied to keys.
+    [[no_unique_address]] level_generator random_engine_; ///< The source of random bits for tower heights.
+    std::array<link, MAX_HEIGHT> head_{};            ///< The forward links of the sentinel head; never marked.
+    std::atomic<int> current_height_{1};             ///< Only grows; levels above it are empty.
+    std::atomic<size_type> element_count_{0};
+    mutable epoch_domain domain_; ///< Declared last, so retired nodes are freed while the allocator is alive.
+
+    static node* to_node(std::uintptr_t value) noexcept {
+        return reinterpret_cast<node*>(value & ~mark_bit);
+    }
+
+    static std::uintptr_t to_link(const node* n) noexcept {
+        return reinterpret_cast<std::uintptr_t>(n);
+    }
+
+    static bool is_marked(std::uintptr_t value) noexcept {
+        return (value & mark_bit) != 0;
+    }
+
+    /// @brief Returns the number of storage units a node of the given height occupies.
+    static size_type node_units(int height) noexcept {
+        return (sizeof(node) + static_cast<size_type>(height) * sizeof(link) + sizeof(storage_unit) - 1) /
+               sizeof(storage_unit);
+    }
+
+    /// @brief Frees a node handed back by the epoch domain.
+    static void reclaim(void* context, epoch_hook* object) noexcept {
+        static_cast<concurrent_skip_list*>(context)->destroy_node(static_cast<node*>(object));
+    }
+
+    int generateRandomHeight() const {
+        const int height = 1 + std::countr_zero(static_cast<std::uint64_t>(random_engine_())) / PROMOTION_SHIFT;
+        return std::min(height, MAX_HEIGHT);
+    }
+
+    template<typename... Args>
+    node* create_node(int height, Args&&... args) {
+        const size_type units = node_units(height);
+        storage_unit* block = unit_traits::allocate(allocator_, units);
+        node* n;
+        try {
+            n = ::new (static_cast<void*>(block)) node(height, std::forward<Args>(args)...);
+        } catch (...) {
+            unit_traits::deallocate(allocator_, block, units);
+            throw;
+        }
+        for (int i = 0; i < height; ++i) {
+            ::new (static_cast<void*>(n->next() + i)) link(0);
+        }
+        return n;
+    }
+
+    void destroy_node(node* n) noexcept {
+        const int height = n->height;
+        n->~node();
+        unit_traits::deallocate(allocator_, reinterpret_cast<storage_unit*>(n), node_units(height));
+    }
+
+    /// @brief Raises the list height so that searches descend from at least `height` levels.
+    void raise_height(int height) noexcept {
+        int top = current_height_.load(std::memory_order_relaxed);
+        while (top < height &&
+               !current_height_.compare_exchange_weak(top, height, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief One attempt of find(); fails when another thread changed a link it tried to snip.
+     * @return `false` if the search must restart, `true` once `preds`/`succs` are filled.
+     */
+    template<typename K>
+    bool try_find(const K& key, predecessors_type& preds, successors_type& succs) {
+        tower_ptr pred = head_.data();
+        for (int level = current_height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+            node* curr = to_node(pred[level].load(std::memory_order_acquire));
+            while (curr) {
+                std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                if (is_marked(succ)) {
+                    // Help the eraser: unlink the marked node from this level.
+                    std::uintptr_t expected = to_link(curr);
+                    if (!pred[level].compare_exchange_strong(expected, succ & ~mark_bit, std::memory_order_acq_rel,
+                                                             std::memory_order_acquire)) {
+                        return false;
+                    }
+                    curr = to_node(succ);
+                    continue;
+                }
+                if (!comp_(curr->key, key)) {
+                    break;
+                }
+                pred = curr->next();
+                curr = to_node(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Finds the neighbours of a key on every level, unlinking the marked nodes met.
+     *
+     * Levels at or above the list height read at the start are left untouched.
+     * @param key The key to search for.
+     * @param preds Receives, per level, the tower of the last node less than `key`.
+     * @param succs Receives, per level, the first unmarked node not less than `key`.
+     * @return `true` if `succs[0]` holds a key equivalent to `key`.
+     */
+    template<typename K>
+    bool find(const K& key, predecessors_type& preds, successors_type& succs) {
+        while (!try_find(key, preds, succs)) {
+        }
+        return succs[0] && !comp_(key, succs[0]->key);
+    }
+
+    /**
+     * @brief One attempt of unlink(); fails when another thread changed a link it tried to snip.
+     *
+     * Unlike try_find(), the walk of each level does not stop at the first unmarked node
+     * equivalent to `key`: it keeps going until a greater key, snipping every marked node
+     * of the run on the way.
+     */
+    template<typename K>
+    bool try_unlink(const K& key) {
+        tower_ptr pred = head_.data(); // The last node less than `key`, where the next level starts.
+        for (int level = current_height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+            tower_ptr last = pred; // The last unmarked node met on this level.
+            node* curr = to_node(pred[level].load(std::memory_order_acquire));
+            while (curr) {
+                std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                if (is_marked(succ)) {
+                    std::uintptr_t expected = to_link(curr);
+                    if (!last[level].compare_exchange_strong(expected, succ & ~mark_bit, std::memory_order_acq_rel,
+                                                             std::memory_order_acquire)) {
+                        return false;
+                    }
+                    curr = to_node(succ);
+                    continue;
+                }
+                if (comp_(key, curr->key)) {
+                    break;
+                }
+                if (comp_(curr->key, key)) {
+                    pred = curr->next();
+                }
+                last = curr->next();
+                curr = to_node(succ);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Unlinks from every level each marked node holding a key equivalent to `key`.
+     *
+     * find() is not enough to unlink an erased node: an insertion that read the node
+     * before it was marked may have linked an upper level of its own node in front of
+     * it, with the same key, and find() stops there.
+     */
+    template<typename K>
+    void unlink(const K& key) {
+        while (!try_unlink(key)) {
+        }
+    }
+
+    /**
+     * @brief Returns the first unmarked node not less than a key, without writing anything.
+     */
+    template<typename K>
+    node* lower_bound_node(const K& key) const {
+        tower_ptr pred = const_cast<tower_ptr>(head_.data());
+        node* curr = nullptr;
+        for (int level = current_height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+            curr = to_node(pred[level].load(std::memory_order_acquire));
+            while (curr) {
+                const std::uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                if (is_marked(succ)) {
+                    curr = to_node(succ);
+                } else if (comp_(curr->key, key)) {
+                    pred = curr->next();
+                    curr = to_node(succ);
+                } else {
+                    break;
+                }
+            }
+        }
+        return curr;
+    }
+
+    /// @brief Returns the node holding a key equivalent to `key`, or nullptr.
+    template<typename K>
+    node* find_node(const K& key) const {
+        node* n = lower_bound_node(key);
+        return n && !comp_(key, n->key) ? n : nullptr;
+    }
+
+    /// @brief Returns the first unmarked node reachable at level 0 from a link value.
+    static node* first_live(std::uintptr_t value) noexcept {
+        node* n = to_node(value);
+        while (n) {
+            const std::uintptr_t succ = n->next()[0].load(std::memory_order_acquire);
+            if (!is_marked(succ)) {
+                break;
+            }
+            n = to_node(succ);
+        }
+        return n;
+    }
+
+    /// @brief Drops one owner of a published node, retiring it when none is left.
+    static void release(node* n, epoch_domain::guard& guard) noexcept {
+        if (n->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            guard.retire(n);
+        }
+    }
+
+    /**
+     * @brief Inserts a node built from `args` unless a key equivalent to `key` is present.
+     *
+     * The node is built after the first search fails to find `key`, so `key` may refer to
+     * an argument that the construction moves from.
+     */
+    template<typename... Args>
+    bool insert_unique(const key_type& key, Args&&... args) {
+        epoch_domain::guard guard = domain_.pin();
+        predecessors_type preds;
+        successors_type succs;
+        node* fresh = nullptr;
+
+        // Raise the height first, so that every search that can reach the node descends through all its levels.
+        const int height = generateRandomHeight();
+        raise_height(height);
+
+        for (;;) {
+            if (find(fresh ? fresh->key : key, preds, succs)) {
+                if (fresh) {
+                    destroy_node(fresh); // Never published.
+                }
+                return false;
+            }
+            if (!fresh) {
+                fresh = create_node(height, std::forward<Args>(args)...);
+            }
+            for (int level = 0; level < height; ++level) {
+                fresh->next()[level].store(to_link(succs[level]), std::memory_order_relaxed);
+            }
+            std::uintptr_t expected = to_link(succs[0]);
+            if (preds[0][0].compare_exchange_strong(expected, to_link(fresh), std::memory_order_acq_rel,
+                                                    std::memory_order_acquire)) {
+                break; // Linearization point: the key is in the set.
+            }
+        }
+        element_count_.fetch_add(1, std::memory_order_relaxed);
+
+        bool abandoned = false;
+        for (int level = 1; level < height && !abandoned; ++level) {
+            for (;;) {
+                std::uintptr_t own = fresh->next()[level].load(std::memory_order_acquire);
+                const std::uintptr_t wanted = to_link(succs[level]);
+                // Only an eraser changes the link of a level not linked yet, and it only marks it.
+                if (is_marked(own) ||
+                    (own != wanted && !fresh->next()[level].compare_exchange_strong(
+                                          own, wanted, std::memory_order_acq_rel, std::memory_order_acquire))) {
+                    abandoned = true; // Being erased: stop linking.
+                    break;
+                }
+                std::uintptr_t expected = wanted;
+                if (preds[level][level].compare_exchange_strong(expected, to_link(fresh), std::memory_order_acq_rel,
+                                                                std::memory_order_acquire)) {
+                    break;
+                }
+                find(fresh->key, preds, succs);
+                if (succs[0] != fresh) {
+                    abandoned = true; // Erased meanwhile.
+                    break;
+                }
+            }
+        }
+
+        if (is_marked(fresh->next()[0].load(std::memory_order_acquire))) {
+            // An eraser may have unlinked the node before a level was linked; unlink it again.
+            unlink(fresh->key);
+        }
+        release(fresh, guard);
+        return true;
+    }
+
+    template<typename K>
+    bool erase_key(const K& key) {
+        epoch_domain::guard guard = domain_.pin();
+        predecessors_type preds;
+        successors_type succs;
+        if (!find(key, preds, succs)) {
+            return false;
+        }
+
+        node* victim = succs[0];
+        for (int level = victim->height - 1; level >= 1; --level) {
+            std::uintptr_t succ = victim->next()[level].load(std::memory_order_acquire);
+            while (!is_marked(succ) &&
+                   !victim->next()[level].compare_exchange_weak(succ, succ | mark_bit, std::memory_order_acq_rel,
+                                                                std::memory_order_acquire)) {
+            }
+        }
+        std::uintptr_t succ = victim->next()[0].load(std::memory_order_acquire);
+        for (;;) {
+            if (is_marked(succ)) {
+                return false; // Another thread erased it first.
+            }
+            if (victim->next()[0].compare_exchange_weak(succ, succ | mark_bit, std::memory_order_acq_rel,
+                                                        std::memory_order_acquire)) {
+                break; // Linearization point: the key left the set.
+            }
+        }
+        element_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        unlink(key);
+        release(victim, guard);
+        return true;
+    }
+
+public:
+    /**
+     * @class const_iterator
+     * @brief A weakly consistent forward iterator that keeps the epoch pinned.
+     *
+     * While it is not at the end, the iterator pins the calling thread, so the node it
+     * designates stays valid even after a concurrent erase. It must be used and destroyed
+     * on the thread that created it; copies pin again, reaching the end unpins.
+     */
+    class const_iterator {
+        friend class concurrent_skip_list;
+
+        const concurrent_skip_list* owner_ = nullptr;
+        node* current_node_ = nullptr;
+        std::optional<epoch_domain::guard> guard_;
+
+        const_iterator(const concurrent_skip_list* owner, node* n, epoch_domain::guard&& guard)
+            : owner_(owner), current_node_(n) {
+            if (n) {
+                guard_.emplace(std::move(guard));
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Key;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Key*;
+        using reference = const Key&;
+
+        const_iterator() = default;
+
+        const_iterator(const const_iterator& other) : owner_(other.owner_), current_node_(other.current_node_) {
+            if (other.guard_) {
+                guard_.emplace(owner_->domain_.pin());
+            }
+        }
+
+        const_iterator(const_iterator&& other) noexcept : owner_(other.owner_), current_node_(other.current_node_) {
+            if (other.guard_) {
+                guard_.emplace(std::move(*other.guard_));
+                other.guard_.reset();
+            }
+        }
+
+        const_iterator& operator=(const const_iterator& other) {
+            if (this != &other) {
+                guard_.reset();
+                owner_ = other.owner_;
+                current_node_ = other.current_node_;
+                if (other.guard_) {
+                    guard_.emplace(owner_->domain_.pin());
+                }
+            }
+            return *this;
+        }
+
+        const_iterator& operator=(const_iterator&& other) noexcept {
+            if (this != &other) {
+                guard_.reset();
+                owner_ = other.owner_;
+                current_node_ = other.current_node_;
+                if (other.guard_) {
+                    guard_.emplace(std::move(*other.guard_));
+                    other.guard_.reset();
+                }
+            }
+            return *this;
+        }
+
+        reference operator*() const { return current_node_->key; }
+        pointer operator->() const { return &current_node_->key; }
+
+        /// @brief Moves to the next key that is not being erased.
+        const_iterator& operator++() {
+            current_node_ = first_live(current_node_->next()[0].load(std::memory_order_acquire));
+            if (!current_node_) {
+                guard_.reset();
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            return a.current_node_ == b.current_node_;
+        }
+    };
+
+    /**
+     * @brief Constructs an empty list.
+     */
+    concurrent_skip_list() : concurrent_skip_list(Compare(), Allocator()) {}
+
+    /**
+     * @brief Constructs an empty list that obtains its memory from the given allocator.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit concurrent_skip_list(const Allocator& alloc) : concurrent_skip_list(Compare(), alloc) {}
+
+    /**
+     * @brief Constructs an empty list ordered by the given comparator.
+     * @param comp The ordering applied to keys.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit concurrent_skip_list(const Compare& comp, const Allocator& alloc = Allocator())
+        : allocator_(alloc), comp_(comp), domain_(&reclaim, this) {}
+
+    concurrent_skip_list(const concurrent_skip_list&) = delete;
+    concurrent_skip_list& operator=(const concurrent_skip_list&) = delete;
+
+    /**
+     * @brief Frees every node, linked or retired. No other thread may use the list.
+     */
+    ~concurrent_skip_list() {
+        node* n = to_node(head_[0].load(std::memory_order_acquire));
+        while (n) {
+            node* next = to_node(n->next()[0].load(std::memory_order_relaxed));
+            destroy_node(n);
+            n = next;
+        }
+    }
+
+    /**
+     * @brief Returns a copy of the allocator associated with the list.
+     */
+    allocator_type get_allocator() const { return allocator_type(allocator_); }
+
+    /**
+     * @brief Returns the comparator that orders the keys.
+     */
+    key_compare key_comp() const { return comp_; }
+
+    /**
+     * @brief Inserts a key if no equivalent key is present. Lock-free.
+     *
+     * @param key The key to insert.
+     * @return `true` if the key was inserted, `false` if it was already present.
+     */
+    bool insert(const key_type& key) {
+        return insert_unique(key, key);
+    }
+
+    /**
+     * @copydoc insert(const key_type&)
+     */
+    bool insert(key_type&& key) {
+        return insert_unique(key, std::move(key));
+    }
+
+    /**
+     * @brief Removes a key. Lock-free.
+     *
+     * The node is unlinked at once and freed once no thread can still be reading it.
+     * @param key The key to remove.
+     * @return `true` if this call removed the key, `false` if it was absent.
+     */
+    bool erase(const key_type& key) {
+        return erase_key(key);
+    }
+
+    /**
+     * @brief Removes the key equivalent to a key of another type (transparent comparators only).
+     *
+     * @param key A value comparable with the stored keys.
+     * @return `true` if this call removed the key, `false` if it was absent.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool erase(const K& key) {
+        return erase_key(key);
+    }
+
+    /**
+     * @brief Searches for a key. Lock-free, and writes no shared memory.
+     *
+     * @param key The key to search for.
+     * @return `true` if the key is present.
+     */
+    bool contains(const key_type& key) const {
+        epoch_domain::guard guard = domain_.pin();
+        return find_node(key) != nullptr;
+    }
+
+    /**
+     * @brief Searches for a key of another type without building a temporary key
+     *        (transparent comparators only).
+     *
+     * @param key A value comparable with the stored keys.
+     * @return `true` if an equivalent key is present.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool contains(const K& key) const {
+        epoch_domain::guard guard = domain_.pin();
+        return find_node(key) != nullptr;
+    }
+
+    /**
+     * @brief Returns an iterator to a key, or end() if it is absent.
+     *
+     * @param key The key to search for.
+     */
+    const_iterator find(const key_type& key) const {
+        epoch_domain::guard guard = domain_.pin();
+        return const_iterator(this, find_node(key), std::move(guard));
+    }
+
+    /**
+     * @brief Returns an iterator to the key equivalent to `key` (transparent comparators only).
+     *
+     * @param key A value comparable with the stored keys.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(const K& key) const {
+        epoch_domain::guard guard = domain_.pin();
+        return const_iterator(this, find_node(key), std::move(guard));
+    }
+
+    /**
+     * @brief Returns an iterator to the first key not less than `key`.
+     *
+     * @param key The key to search for.
+     */
+    const_iterator lower_bound(const key_type& key) const {
+        epoch_domain::guard guard = domain_.pin();
+        return const_iterator(this, lower_bound_node(key), std::move(guard));
+    }
+
+    /**
+     * @brief Returns an iterator to the smallest key.
+     */
+    const_iterator begin() const {
+        epoch_domain::guard guard = domain_.pin();
+        return const_iterator(this, first_live(head_[0].load(std::memory_order_acquire)), std::move(guard));
+    }
+
+    /**
+     * @brief Returns the past-the-end iterator. It holds no pin.
+     */
+    const_iterator end() const { return const_iterator(); }
+
+    /// @copydoc begin()
+    const_iterator cbegin() const { return begin(); }
+
+    /// @copydoc end()
+    const_iterator cend() const { return end(); }
+
+    /**
+     * @brief Returns the number of keys; approximate while mutations are in flight.
+     */
+    size_type size() const { return element_count_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether the list holds no key; approximate while mutations are in flight.
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Frees the erased nodes of the calling thread that no reader can reach any more.
+     *
+     * Erasure does this on its own every epoch_domain::collect_threshold nodes; calling it
+     * merely releases memory sooner, e.g. after a burst of erasures.
+     */
+    void collect() { domain_.collect(); }
+};
+
+#endif // CONCURRENT_SKIP_LIST_HPP
@@ -0,0 +1,279 @@
+/**
+ * @file epoch_domain.hpp
+ * @brief Provides epoch-based memory reclamation for lock-free containers.
+ *
+ * This file contains the declaration and definition of the epoch_domain class,
+ * which defers freeing unlinked objects until no thread can still be reading them.
+ *
+ */
+
+#ifndef EPOCH_DOMAIN_HPP
+#define EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @struct epoch_hook
+ * @brief The intrusive link an object needs to be retired into an epoch_domain.
+ *
+ * The link is written only when the object is retired, after it has been unlinked
+ * from its container, so readers that still hold the object never see it change.
+ */
+struct epoch_hook {
+    epoch_hook* next_retired = nullptr; ///< The next object in the same limbo list.
+};
+
+/**
+ * @class epoch_domain
+ * @brief Epoch-based reclamation: retired objects are freed once every reader has moved on.
+ *
+ * Threads pin the domain (see guard) for the duration of each operation that reads
+ * shared nodes. An object unlinked by a pinned thread is passed to retire(); it is
+ * handed to the reclaim callback only after the global epoch has advanced twice,
+ * which cannot happen while any thread that might have seen the object stays pinned.
+ *
+ * Each thread gets its own record the first time it pins the domain; records live as
+ * long as the domain. The destructor reclaims everything still retired, so no thread
+ * may be pinned or use the domain any more at that point.
+ */
+class epoch_domain {
+public:
+    /// The callback that frees a retired object; `context` is the pointer given to the constructor.
+    using reclaim_fn = void (*)(void* context, epoch_hook* object) noexcept;
+
+    static constexpr std::size_t collect_threshold = 64; ///< Retirements per thread between two collection attempts.
+
+private:
+    static constexpr std::uint64_t active_bit = 1; ///< Set in a record's state while its thread is pinned.
+
+    /// @brief Objects retired by one thread during one epoch.
+    struct limbo_list {
+        std::uint64_t epoch = 0;
+        epoch_hook* head = nullptr;
+    };
+
+    /// @brief The per-thread state; each record sits on its own cache line.
+    struct alignas(64) thread_record {
+        std::atomic<std::uint64_t> state{0}; ///< `epoch << 1 | active_bit` while pinned, 0 otherwise.
+        std::thread::id owner;               ///< The thread the record belongs to.
+        int nesting = 0;                     ///< The number of live guards of the owner.
+        std::size_t retired_since_collect = 0;
+        std::array<limbo_list, 3> limbo{};   ///< Indexed by epoch modulo 3.
+        thread_record* next = nullptr;       ///< The next record of the registry.
+    };
+
+    std::atomic<std::uint64_t> global_epoch_{2};
+    std::atomic<thread_record*> records_{nullptr};
+    reclaim_fn reclaim_;
+    void* context_;
+    std::uint64_t id_; ///< Distinguishes domains in the per-thread record cache, even at reused addresses.
+
+    /// @brief Returns a process-wide unique domain id.
+    static std::uint64_t next_id() noexcept {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /// @brief Returns the calling thread's record, registering one on first use.
+    thread_record& local_record() {
+        struct cache_entry {
+            std::uint64_t domain = 0;
+            thread_record* record = nullptr;
+        };
+        thread_local std::array<cache_entry, 4> cache{};
+        thread_local std::size_t victim = 0;
+
+        for (const cache_entry& entry : cache) {
+            if (entry.domain == id_) {
+                return *entry.record;
+            }
+        }
+
+        const std::thread::id self = std::this_thread::get_id();
+        thread_record* record = records_.load(std::memory_order_acquire);
+        while (record && record->owner != self) {
+            record = record->next;
+        }
+        if (record) {
+            // A finished thread may have had the same id: synchronize with its last unpin.
+            (void)record->state.load(std::memory_order_acquire);
+        } else {
+            record = new thread_record;
+            record->owner = self;
+            record->next = records_.load(std::memory_order_relaxed);
+            while (!records_.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {
+            }
+        }
+
+        cache[victim] = {id_, record};
+        victim = (victim + 1) % cache.size();
+        return *record;
+    }
+
+    /// @brief Hands every object of a limbo list to the reclaim callback.
+    void reclaim_list(limbo_list& list) noexcept {
+        epoch_hook* object = list.head;
+        list.head = nullptr;
+        while (object) {
+            epoch_hook* next = object->next_retired;
+            reclaim_(context_, object);
+            object = next;
+        }
+    }
+
+    /**
+     * @brief Advances the global epoch if every pinned thread has observed the current one.
+     * @return The global epoch after the attempt.
+     */
+    std::uint64_t try_advance() noexcept {
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        for (thread_record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            const std::uint64_t state = record->state.load(std::memory_order_seq_cst);
+            if ((state & active_bit) && (state >> 1) != epoch) {
+                return epoch; // A thread is still pinned in an older epoch.
+            }
+        }
+        if (global_epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst)) {
+            return epoch + 1;
+        }
+        return epoch; // Another thread advanced it; `epoch` now holds the new value.
+    }
+
+    /// @brief Reclaims the calling thread's limbo lists that no reader can reach any more.
+    void collect(thread_record& record) noexcept {
+        record.retired_since_collect = 0;
+        const std::uint64_t epoch = try_advance();
+        for (limbo_list& list : record.limbo) {
+            if (list.head && list.epoch + 2 <= epoch) {
+                reclaim_list(list);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs a domain.
+     * @param reclaim Frees a retired object.
+     * @param context Passed to `reclaim` along with every object.
+     */
+    epoch_domain(reclaim_fn reclaim, void* context) noexcept
+        : reclaim_(reclaim), context_(context), id_(next_id()) {}
+
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    /**
+     * @brief Reclaims every retired object and releases the thread records.
+     *
+     * No thread may be pinned.
+     */
+    ~epoch_domain() {
+        reclaim_all();
+        thread_record* record = records_.load(std::memory_order_acquire);
+        while (record) {
+            thread_record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    /**
+     * @class guard
+     * @brief Keeps the calling thread pinned, so no object it can reach is reclaimed.
+     *
+     * Guards nest; the thread is unpinned when its last guard is destroyed. A guard
+     * belongs to the thread that created it.
+     */
+    class guard {
+        friend class epoch_domain;
+
+        epoch_domain* domain_;
+        thread_record* record_;
+
+        guard(epoch_domain& domain, thread_record& record) noexcept : domain_(&domain), record_(&record) {}
+
+    public:
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+        /// @brief Transfers the pin of another guard.
+        guard(guard&& other) noexcept : domain_(other.domain_), record_(other.record_) { other.record_ = nullptr; }
+
+        /// @brief Unpins the thread if this is its last guard.
+        ~guard() {
+            if (record_ && --record_->nesting == 0) {
+                record_->state.store(0, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief Defers reclaiming an object until no pinned thread can still reach it.
+         *
+         * The object must already be unreachable for threads that pin the domain from
+         * now on. Every `collect_threshold` retirements the thread tries to advance the
+         * epoch and frees its own old limbo lists.
+         * @param object The unlinked object.
+         */
+        void retire(epoch_hook* object) noexcept {
+            thread_record& record = *record_;
+            // The global epoch, not the pinned one: readers pinned since may hold the object too.
+            const std::uint64_t epoch = domain_->global_epoch_.load(std::memory_order_seq_cst);
+            limbo_list& list = record.limbo[epoch % 3];
+            if (list.epoch != epoch) {
+                // The list holds objects retired three or more epochs ago: all safe to free.
+                domain_->reclaim_list(list);
+                list.epoch = epoch;
+            }
+            object->next_retired = list.head;
+            list.head = object;
+
+            if (++record.retired_since_collect >= collect_threshold) {
+                domain_->collect(record);
+            }
+        }
+    };
+
+    /**
+     * @brief Pins the calling thread until the returned guard is destroyed.
+     */
+    guard pin() {
+        thread_record& record = local_record();
+        if (record.nesting++ == 0) {
+            // Publish the pin before any shared node is read (seq_cst pairs with try_advance()).
+            record.state.store(global_epoch_.load(std::memory_order_seq_cst) << 1 | active_bit,
+                               std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        return guard(*this, record);
+    }
+
+    /**
+     * @brief Tries to advance the epoch and reclaims the calling thread's old limbo lists.
+     *
+     * Retirement does this on its own every `collect_threshold` objects; calling it is
+     * only useful to release memory sooner, e.g. once a burst of erasures is over.
+     */
+    void collect() {
+        collect(local_record());
+    }
+
+    /**
+     * @brief Reclaims every retired object of every thread at once.
+     *
+     * No thread may be pinned, and none may retire objects concurrently.
+     */
+    void reclaim_all() noexcept {
+        for (thread_record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            for (limbo_list& list : record->limbo) {
+                reclaim_list(list);
+            }
+        }
+    }
+};
+
+#endif // EPOCH_DOMAIN_HPP
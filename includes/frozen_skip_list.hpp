@@ -0,0 +1,305 @@
+/**
+ * @file frozen_skip_list.hpp
+ * @brief Provides an immutable, read-optimized copy of a skip list.
+ *
+ * This file contains the declaration and definition of the basic_frozen_skip_list class,
+ * returned by basic_skip_list::freeze(), and its frozen_skip_list and frozen_skip_map aliases.
+ *
+ */
+
+#ifndef FROZEN_SKIP_LIST_HPP
+#define FROZEN_SKIP_LIST_HPP
+
+#include "skip_list.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ * @class basic_frozen_skip_list
+ * @brief An immutable ordered container laid out for lookups, see basic_skip_list::freeze().
+ *
+ * The elements sit in one array in key order, cut into blocks of one cache line each.
+ * The first key of every block is copied into an upper index stored in Eytzinger (BFS)
+ * order, the layout of an implicit binary search tree: a lookup walks it with one
+ * branch-free comparison per level while prefetching the nodes four levels down, then
+ * finishes with a branch-free binary search inside one block. Lookups thus touch about
+ * log(n / block) index lines that stay cached across queries plus one or two lines of
+ * elements, and iteration is a scan of the array.
+ *
+ * @tparam Value The type of the stored elements.
+ * @tparam KeyOfValue A function object extracting the ordering key from a stored value.
+ * @tparam Compare A strict weak ordering on keys. If it declares `is_transparent`,
+ *         lookups accept any type comparable with the key.
+ * @tparam Allocator The allocator the element and index arrays are obtained from.
+ */
+template<typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class basic_frozen_skip_list {
+public:
+    using key_type = std::remove_cvref_t<decltype(KeyOfValue{}(std::declval<const Value&>()))>;
+    using value_type = Value;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using reference = const Value&;
+    using const_reference = const Value&;
+
+private:
+    using value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Value>;
+    using key_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<key_type>;
+    using rank_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>;
+
+    /// The number of elements per block: as many as fit in a cache line, at least one.
+    static constexpr size_type block_size = std::max<size_type>(1, 64 / sizeof(Value));
+    /// How far down the index is prefetched: the Eytzinger nodes 4 levels below `k` start at `16 * k`.
+    static constexpr size_type prefetch_levels = 4;
+
+    std::vector<Value, value_allocator> values_;   ///< The elements in key order.
+    std::vector<key_type, key_allocator> index_;   ///< Block first keys in Eytzinger order; slot `k` at `k - 1`.
+    std::vector<size_type, rank_allocator> block_; ///< The block number of every index slot.
+    [[no_unique_address]] KeyOfValue key_of_;
+    [[no_unique_address]] Compare comp_;
+
+    /// @brief Fills the index subtree rooted at slot `k` with the blocks from `next` on, in order.
+    void build_index(size_type k, size_type& next) {
+        if (k <= index_.size()) {
+            build_index(2 * k, next);
+            index_[k - 1] = key_of_(values_[next * block_size]);
+            block_[k - 1] = next++;
+            build_index(2 * k + 1, next);
+        }
+    }
+
+    /// @brief Builds the index over `values_`, which are sorted and unique.
+    void index_values() {
+        if (values_.empty()) {
+            return;
+        }
+        const size_type blocks = (values_.size() + block_size - 1) / block_size;
+        index_.assign(blocks, key_of_(values_.front()));
+        block_.assign(blocks, 0);
+        size_type next = 0;
+        build_index(1, next);
+    }
+
+    /**
+     * @brief Returns the position of the first element that `before` does not hold for.
+     *
+     * `before(key)` must be true for a prefix of the keys in order and false afterwards.
+     */
+    template<typename Before>
+    size_type partition_point(Before before) const {
+        const size_type blocks = index_.size();
+        size_type k = 1;
+        while (k <= blocks) {
+            skip_list_detail::prefetch(index_.data() + std::min((k << prefetch_levels) - 1, blocks - 1));
+            k = 2 * k + static_cast<size_type>(before(index_[k - 1]));
+        }
+        k >>= std::countr_one(k) + 1; // Climb to the slot of the first block not before the key, 0 if none.
+        const size_type first_after = k ? block_[k - 1] : blocks;
+        if (first_after == 0) {
+            return 0;
+        }
+
+        // Blocks before `first_after` start before the key: it lies in the last of them, past its first element.
+        const Value* base = values_.data() + (first_after - 1) * block_size + 1;
+        size_type length = std::min(first_after * block_size, values_.size()) - ((first_after - 1) * block_size + 1);
+        while (length > 0) {
+            const size_type half = length / 2;
+            const bool in_upper = before(key_of_(base[half]));
+            base = in_upper ? base + half + 1 : base;
+            length = in_upper ? length - half - 1 : half;
+        }
+        return static_cast<size_type>(base - values_.data());
+    }
+
+    template<typename K>
+    size_type lower_position(const K& key) const {
+        return partition_point([this, &key](const key_type& probe) { return comp_(probe, key); });
+    }
+
+    template<typename K>
+    size_type upper_position(const K& key) const {
+        return partition_point([this, &key](const key_type& probe) { return !comp_(key, probe); });
+    }
+
+    template<typename K>
+    size_type find_position(const K& key) const {
+        const size_type position = lower_position(key);
+        return position < values_.size() && !comp_(key, key_of_(values_[position])) ? position : values_.size();
+    }
+
+public:
+    using const_iterator = typename std::vector<Value, value_allocator>::const_iterator;
+    using iterator = const_iterator;
+
+    /**
+     * @brief Constructs an empty container.
+     * @param comp The ordering of the keys.
+     * @param alloc The allocator of the arrays.
+     */
+    explicit basic_frozen_skip_list(const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : values_(value_allocator(alloc)), index_(key_allocator(alloc)), block_(rank_allocator(alloc)), comp_(comp) {}
+
+    /**
+     * @brief Constructs the container from a range of elements.
+     *
+     * A range already sorted by strictly increasing keys, such as a skip list, is copied as
+     * is after an O(n) check; any other range is sorted and, of equivalent elements, the
+     * first one is kept.
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     * @param comp The ordering of the keys.
+     * @param alloc The allocator of the arrays.
+     */
+    template<std::input_iterator InputIt>
+    basic_frozen_skip_list(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : values_(first, last, value_allocator(alloc)), index_(key_allocator(alloc)), block_(rank_allocator(alloc)),
+          comp_(comp) {
+        const auto not_ascending = [this](const Value& a, const Value& b) { return !comp_(key_of_(a), key_of_(b)); };
+        if (std::adjacent_find(values_.begin(), values_.end(), not_ascending) != values_.end()) {
+            // Sort positions rather than elements: the values of a map are not assignable.
+            std::vector<size_type, rank_allocator> order(values_.size(), rank_allocator(alloc));
+            std::iota(order.begin(), order.end(), size_type{0});
+            const auto position_less = [this](size_type a, size_type b) {
+                return comp_(key_of_(values_[a]), key_of_(values_[b]));
+            };
+            std::stable_sort(order.begin(), order.end(), position_less);
+            const auto equivalent = [&position_less](size_type a, size_type b) { return !position_less(a, b); };
+            order.erase(std::unique(order.begin(), order.end(), equivalent), order.end());
+            std::vector<Value, value_allocator> sorted{value_allocator(alloc)};
+            sorted.reserve(order.size());
+            for (size_type position : order) {
+                sorted.push_back(std::move(values_[position]));
+            }
+            values_.swap(sorted);
+        }
+        index_values();
+    }
+
+    /// @brief Returns the number of elements.
+    size_type size() const noexcept { return values_.size(); }
+
+    /// @brief Checks whether the container is empty.
+    bool empty() const noexcept { return values_.empty(); }
+
+    /// @brief Returns a copy of the allocator of the arrays.
+    allocator_type get_allocator() const { return allocator_type(values_.get_allocator()); }
+
+    /// @brief Returns the comparator that orders the keys.
+    key_compare key_comp() const { return comp_; }
+
+    /// @brief Returns an iterator to the first element.
+    const_iterator begin() const noexcept { return values_.begin(); }
+
+    /// @brief Returns the past-the-end iterator.
+    const_iterator end() const noexcept { return values_.end(); }
+
+    /**
+     * @brief Checks whether an element with a specific key is present.
+     * @param key The key to look for.
+     */
+    bool contains(const key_type& key) const { return find_position(key) != values_.size(); }
+
+    /**
+     * @copydoc contains(const key_type&) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool contains(const K& key) const { return find_position(key) != values_.size(); }
+
+    /**
+     * @brief Finds the element with a specific key.
+     * @param key The key to find.
+     * @return An iterator to the found element, or `end()` if the element is not found.
+     */
+    const_iterator find(const key_type& key) const { return begin() + static_cast<difference_type>(find_position(key)); }
+
+    /**
+     * @copydoc find(const key_type&) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(const K& key) const { return begin() + static_cast<difference_type>(find_position(key)); }
+
+    /**
+     * @brief Returns an iterator to the first element whose key is not less than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator lower_bound(const key_type& key) const {
+        return begin() + static_cast<difference_type>(lower_position(key));
+    }
+
+    /**
+     * @copydoc lower_bound(const key_type&) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator lower_bound(const K& key) const {
+        return begin() + static_cast<difference_type>(lower_position(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element whose key is greater than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator upper_bound(const key_type& key) const {
+        return begin() + static_cast<difference_type>(upper_position(key));
+    }
+
+    /**
+     * @copydoc upper_bound(const key_type&) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator upper_bound(const K& key) const {
+        return begin() + static_cast<difference_type>(upper_position(key));
+    }
+
+    /**
+     * @brief Returns the range of elements equivalent to `key`: empty or a single element.
+     * @param key The key to compare against.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        const const_iterator lower = lower_bound(key);
+        return {lower, lower != end() && !comp_(key, key_of_(*lower)) ? std::next(lower) : lower};
+    }
+
+    /**
+     * @brief Returns the number of elements whose key is less than `key`.
+     * @param key The key to rank.
+     */
+    size_type rank(const key_type& key) const { return lower_position(key); }
+
+    /**
+     * @brief Returns an iterator to the element at a 0-based position.
+     * @param index The position of the element.
+     * @return An iterator to the element, or `end()` if `index >= size()`.
+     */
+    const_iterator nth(size_type index) const {
+        return begin() + static_cast<difference_type>(std::min(index, values_.size()));
+    }
+};
+
+/**
+ * @brief The frozen form of skip_list, see basic_skip_list::freeze().
+ */
+template<typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>>
+using frozen_skip_list = basic_frozen_skip_list<Key, skip_list_detail::identity_key, Compare, Allocator>;
+
+/**
+ * @brief The frozen form of skip_map, see basic_skip_list::freeze().
+ */
+template<typename Key, typename T, typename Compare = std::less<Key>,
+         typename Allocator = std::allocator<std::pair<const Key, T>>>
+using frozen_skip_map = basic_frozen_skip_list<std::pair<const Key, T>, skip_list_detail::select_first, Compare, Allocator>;
+
+#endif // FROZEN_SKIP_LIST_HPP
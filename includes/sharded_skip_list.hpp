@@ -0,0 +1,452 @@
+/**
+ * @file sharded_skip_list.hpp
+ * @brief Provides an ordered set range-partitioned over independent skip lists.
+ *
+ * This file contains the declaration and definition of the sharded_skip_list class,
+ * which spreads keys over several skip_list shards so that threads working on different
+ * key ranges never touch the same head tower, and scans ranges in parallel.
+ *
+ */
+
+#ifndef SHARDED_SKIP_LIST_HPP
+#define SHARDED_SKIP_LIST_HPP
+
+#include "skip_list.hpp"
+#include "epoch_domain.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct sharded_skip_list_traits
+ * @brief The default tuning knobs of every shard of a sharded_skip_list.
+ *
+ * Identical to skip_list_traits except that shards are indexed: a split finds the median
+ * with nth() and cuts the shard with split_at() in O(log n), at the cost of one span
+ * width per forward pointer.
+ */
+struct sharded_skip_list_traits : skip_list_traits {
+    static constexpr bool indexed = true;
+};
+
+/**
+ * @class sharded_skip_list
+ * @brief A thread-safe ordered set whose keys are range-partitioned over up to `N` skip lists.
+ *
+ * A small sorted router maps every key to the shard owning its range. The router is an
+ * immutable snapshot replaced on every split and read without any lock: point operations
+ * only lock the one shard they touch, so threads on different ranges share no cache line.
+ *
+ * The list starts with a single shard. A shard that grows past the split threshold is
+ * split at its median while the list stays in use, until `N` shards exist; split() does
+ * the same on demand. Ranges never merge back. A split holds the shard's exclusive lock
+ * while it cuts the shard: O(log n) with the default, indexed shards, but O(n), about half
+ * the shard, with shard traits that disable `indexed`, stalling the shard's writers.
+ *
+ * for_each_range() scans the shards overlapping a range concurrently, one task per shard,
+ * on a caller-supplied executor. Scans run alongside point operations and splits: each
+ * shard is read under its shared lock, and a task whose stretch of keys was split off
+ * meanwhile follows it into the new shards.
+ *
+ * @tparam Key The type of the keys. It must be copyable, since a split copies the shard median.
+ * @tparam N The maximum number of shards.
+ * @tparam Compare A strict weak ordering on keys.
+ * @tparam Allocator The allocator node memory is obtained from. It follows the `std::allocator_traits` conventions.
+ * @tparam Traits Compile-time tuning knobs of every shard, see sharded_skip_list_traits.
+ */
+template<typename Key, std::size_t N = 16, typename Compare = std::less<Key>,
+         typename Allocator = std::allocator<Key>, typename Traits = sharded_skip_list_traits>
+class sharded_skip_list {
+    static_assert(N >= 1, "A sharded_skip_list needs at least one shard.");
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using shard_type = skip_list<Key, Compare, Allocator, Traits>;
+
+    static constexpr size_type max_shards = N;                     ///< The shard count at which splits stop.
+    static constexpr size_type default_split_threshold = 1 << 16; ///< The default shard size that triggers a split.
+
+private:
+    /// @brief One partition: the keys in `[lower, upper)`.
+    struct alignas(64) shard {
+        mutable std::shared_mutex mutex;
+        shard_type list;
+        const std::optional<Key> lower; ///< The smallest key the shard may hold; none for the first shard. Immutable.
+        std::optional<Key> upper;       ///< The first key past the shard; none for the last. Guarded by `mutex`.
+
+        shard(std::optional<Key> lo, std::optional<Key> hi, const Compare& comp, const Allocator& alloc)
+            : list(comp, alloc), lower(std::move(lo)), upper(std::move(hi)) {}
+    };
+
+    /// @brief An immutable snapshot of the shards in key order.
+    struct router : epoch_hook {
+        size_type count = 0;
+        std::array<shard*, N> shards{};
+    };
+
+    [[no_unique_address]] Compare comp_; ///< The ordering applied to keys.
+    Allocator allocator_;
+    size_type split_threshold_;
+    std::array<std::unique_ptr<shard>, N> storage_; ///< Every shard ever created, in creation order.
+    std::atomic<router*> router_;
+    std::mutex split_mutex_; ///< Serializes splits.
+    mutable epoch_domain domain_; ///< Defers freeing replaced routers past the operations reading them.
+
+    static void reclaim_router(void*, epoch_hook* object) noexcept {
+        delete static_cast<router*>(object);
+    }
+
+    /// @brief Returns the position in `r` of the shard whose range contains `key`.
+    template<typename K>
+    size_type route(const router& r, const K& key) const {
+        size_type lo = 1;
+        size_type hi = r.count;
+        while (lo < hi) {
+            const size_type mid = lo + (hi - lo) / 2;
+            if (comp_(key, *r.shards[mid]->lower)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        return lo - 1;
+    }
+
+    /// @brief Checks whether a shard still owns `key`, which a concurrent split may have changed.
+    template<typename K>
+    bool owns(const shard& s, const K& key) const {
+        return !s.upper || comp_(key, *s.upper);
+    }
+
+    /**
+     * @brief Runs `op(list)` on the shard owning `key`, holding its lock of type `Lock`.
+     *
+     * If a split moved the key away between routing and locking, the lookup is retried
+     * with the newer router.
+     * @return The shard `op` ran on and what `op` returned.
+     */
+    template<template<typename> class Lock, typename K, typename Op>
+    auto with_shard(const K& key, Op op) const {
+        for (;;) {
+            epoch_domain::guard guard = domain_.pin();
+            const router& r = *router_.load(std::memory_order_acquire);
+            shard* s = r.shards[route(r, key)];
+            Lock<std::shared_mutex> lock(s->mutex);
+            if (owns(*s, key)) {
+                return std::pair{s, op(s->list)};
+            }
+        }
+    }
+
+    /// @brief Splits a shard that grew past the threshold, unless another split is running.
+    void maybe_split(shard* s) {
+        std::unique_lock<std::mutex> split_lock(split_mutex_, std::try_to_lock);
+        if (!split_lock.owns_lock()) {
+            return; // The next insertion into the shard tries again.
+        }
+        const router& r = *router_.load(std::memory_order_acquire);
+        for (size_type i = 0; i < r.count; ++i) {
+            if (r.shards[i] == s) {
+                std::shared_lock<std::shared_mutex> lock(s->mutex);
+                const bool grown = s->list.size() > split_threshold_;
+                lock.unlock();
+                if (grown) {
+                    split_locked(i);
+                }
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Moves the upper half of a shard into a new shard and publishes a new router.
+     *
+     * The median is found under the shard's shared lock, and the new shard is built before
+     * the exclusive lock is taken, so writers to the shard wait only for
+     * skip_list::split_at(): O(log n) on indexed shards, otherwise its walk of about
+     * n / 2 nodes to size the halves. If the shard changed so much in between that
+     * the median no longer leaves a key on each side, a new one is picked. The caller
+     * holds `split_mutex_`, so no other split changes the shard's bounds meanwhile.
+     */
+    bool split_locked(size_type index) {
+        router* current = router_.load(std::memory_order_acquire);
+        if (index >= current->count || current->count == N) {
+            return false;
+        }
+
+        shard* s = current->shards[index];
+        std::unique_ptr<shard> fresh;
+        std::unique_lock<std::shared_mutex> lock(s->mutex, std::defer_lock);
+        for (;;) {
+            {
+                std::shared_lock<std::shared_mutex> read_lock(s->mutex);
+                const size_type size = s->list.size();
+                if (size < 2) {
+                    return false;
+                }
+                if constexpr (Traits::indexed) {
+                    fresh = std::make_unique<shard>(*s->list.nth(size / 2), s->upper, comp_, allocator_);
+                } else {
+                    fresh = std::make_unique<shard>(*std::next(s->list.begin(), static_cast<std::ptrdiff_t>(size / 2)),
+                                                    s->upper, comp_, allocator_);
+                }
+            }
+            lock.lock();
+            if (!s->list.empty() && comp_(*s->list.begin(), *fresh->lower) &&
+                s->list.lower_bound(*fresh->lower) != s->list.end()) {
+                break;
+            }
+            lock.unlock();
+        }
+
+        fresh->list = s->list.split_at(*fresh->lower);
+        s->upper = fresh->lower;
+        storage_[current->count] = std::move(fresh);
+
+        auto next = std::make_unique<router>();
+        next->count = current->count + 1;
+        std::copy(current->shards.begin(), current->shards.begin() + (index + 1), next->shards.begin());
+        next->shards[index + 1] = storage_[current->count].get();
+        std::copy(current->shards.begin() + (index + 1), current->shards.begin() + current->count,
+                  next->shards.begin() + (index + 2));
+        // Published before the shard is unlocked, so an operation that finds its key gone sees the new router.
+        router_.store(next.release(), std::memory_order_release);
+        lock.unlock();
+
+        domain_.pin().retire(current);
+        return true;
+    }
+
+    /**
+     * @brief Calls `fn` on the keys in `[from, to)` shard after shard, in ascending order.
+     *
+     * Each shard is read under its shared lock. When the current shard ends before `to`,
+     * the scan continues from its upper bound in whichever shard owns that key now.
+     */
+    template<typename Fn>
+    void scan_interval(const Key& from, const Key& to, Fn& fn) const {
+        std::optional<Key> cursor;
+        const Key* start = &from;
+        for (;;) {
+            epoch_domain::guard guard = domain_.pin();
+            const router& r = *router_.load(std::memory_order_acquire);
+            const shard& s = *r.shards[route(r, *start)];
+            std::shared_lock<std::shared_mutex> lock(s.mutex);
+            if (!owns(s, *start)) {
+                continue; // Split since routing.
+            }
+            for (auto it = s.list.lower_bound(*start); it != s.list.end() && comp_(*it, to); ++it) {
+                fn(*it);
+            }
+            if (!s.upper || !comp_(*s.upper, to)) {
+                return;
+            }
+            cursor = *s.upper;
+            start = &*cursor;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an empty list with a single shard.
+     * @param split_threshold The shard size past which an insertion splits the shard.
+     * @param comp The ordering applied to keys.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit sharded_skip_list(size_type split_threshold = default_split_threshold, const Compare& comp = Compare(),
+                               const Allocator& alloc = Allocator())
+        : comp_(comp), allocator_(alloc), split_threshold_(split_threshold), domain_(&reclaim_router, nullptr) {
+        storage_[0] = std::make_unique<shard>(std::nullopt, std::nullopt, comp_, allocator_);
+        auto first = std::make_unique<router>();
+        first->count = 1;
+        first->shards[0] = storage_[0].get();
+        router_.store(first.release(), std::memory_order_release);
+    }
+
+    sharded_skip_list(const sharded_skip_list&) = delete;
+    sharded_skip_list& operator=(const sharded_skip_list&) = delete;
+
+    /**
+     * @brief Destroys every shard. No other thread may use the list.
+     */
+    ~sharded_skip_list() {
+        delete router_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Inserts a key if no equivalent key is present; thread-safe.
+     *
+     * May split the shard that received the key, see the class description.
+     * @param key The key to insert.
+     * @return `true` if the key was inserted, `false` if it was already present.
+     */
+    bool insert(const key_type& key) {
+        size_type shard_size = 0;
+        auto [s, inserted] = with_shard<std::unique_lock>(key, [&](shard_type& list) {
+            shard_size = list.size();
+            return list.insert(key);
+        });
+        if (inserted && shard_size >= split_threshold_) {
+            maybe_split(s);
+        }
+        return inserted;
+    }
+
+    /**
+     * @brief Removes a key; thread-safe.
+     *
+     * @param key The key to remove.
+     * @return `true` if the key was found and removed, `false` otherwise.
+     */
+    bool erase(const key_type& key) {
+        return with_shard<std::unique_lock>(key, [&](shard_type& list) { return list.erase(key); }).second;
+    }
+
+    /**
+     * @brief Searches for a key; thread-safe, and locks only the owning shard for reading.
+     *
+     * @param key The key to search for.
+     * @return `true` if the key is present.
+     */
+    bool contains(const key_type& key) const {
+        return with_shard<std::shared_lock>(key, [&](const shard_type& list) { return list.contains(key); }).second;
+    }
+
+    /**
+     * @brief Returns the number of keys, summed shard by shard.
+     *
+     * Exact only when no insertion, erasure or split runs concurrently.
+     */
+    size_type size() const {
+        epoch_domain::guard guard = domain_.pin();
+        const router& r = *router_.load(std::memory_order_acquire);
+        size_type total = 0;
+        for (size_type i = 0; i < r.count; ++i) {
+            std::shared_lock<std::shared_mutex> lock(r.shards[i]->mutex);
+            total += r.shards[i]->list.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Checks whether the list holds no key; see size().
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Returns the current number of shards.
+     */
+    size_type shard_count() const {
+        epoch_domain::guard guard = domain_.pin();
+        return router_.load(std::memory_order_acquire)->count;
+    }
+
+    /**
+     * @brief Splits a shard at its median key; thread-safe.
+     *
+     * @param index The position of the shard in key order, below shard_count().
+     * @return `true` if the shard was split, `false` if `N` shards exist already, the index
+     *         is out of range or the shard holds fewer than two keys.
+     */
+    bool split(size_type index) {
+        std::lock_guard<std::mutex> split_lock(split_mutex_);
+        return split_locked(index);
+    }
+
+    /**
+     * @brief Calls `fn(key)` for every key in `[lo, hi)`, scanning the shards concurrently.
+     *
+     * One task per overlapping shard is handed to `executor`, which may run it on any
+     * thread, or inline. Within a task keys arrive in ascending order; tasks run
+     * concurrently, so `fn` must be safe to call from several threads at once. Each shard
+     * is scanned under its shared lock, so a concurrent update is either seen or not, and
+     * the call returns once every task has finished. The first exception thrown by `fn` is rethrown,
+     * as is one thrown by `executor` after the tasks it accepted have finished.
+     * @param lo The first key of the range.
+     * @param hi The end of the range (excluded).
+     * @param fn The function applied to each key.
+     * @param executor Called as `executor(task)` with a copyable, nullary `task`.
+     */
+    template<typename Fn, typename Executor>
+    void for_each_range(const key_type& lo, const key_type& hi, Fn fn, Executor&& executor) const {
+        if (!comp_(lo, hi)) {
+            return;
+        }
+        // Shards are never destroyed and their lower bounds never change, so the task bounds
+        // stay valid after the snapshot is replaced.
+        std::vector<std::pair<const Key*, const Key*>, typename std::allocator_traits<Allocator>::template
+                    rebind_alloc<std::pair<const Key*, const Key*>>> bounds(allocator_);
+        {
+            epoch_domain::guard guard = domain_.pin();
+            const router& r = *router_.load(std::memory_order_acquire);
+            const std::size_t first = route(r, lo);
+            for (std::size_t i = first; i < r.count; ++i) {
+                const Key* from = i == first ? &lo : &*r.shards[i]->lower;
+                if (!comp_(*from, hi)) {
+                    break;
+                }
+                const bool last = i + 1 == r.count || !comp_(*r.shards[i + 1]->lower, hi);
+                bounds.emplace_back(from, last ? &hi : &*r.shards[i + 1]->lower);
+            }
+        }
+
+        const size_type tasks = bounds.size();
+        std::vector<std::exception_ptr> errors(tasks);
+        std::latch done(static_cast<std::ptrdiff_t>(tasks));
+        for (size_type i = 0; i < tasks; ++i) {
+            auto task = [this, &bounds, &fn, &errors, &done, i] {
+                try {
+                    scan_interval(*bounds[i].first, *bounds[i].second, fn);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+                done.count_down();
+            };
+            try {
+                executor(task);
+            } catch (...) {
+                // The tasks already handed out still reference this frame: let them finish.
+                done.count_down(static_cast<std::ptrdiff_t>(tasks - i));
+                done.wait();
+                throw;
+            }
+        }
+        done.wait();
+
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls `fn(key)` for every key in `[lo, hi)`, one thread per overlapping shard.
+     *
+     * Equivalent to the executor overload with an executor that starts a thread per task.
+     * Long-running programs should pass a thread pool instead.
+     */
+    template<typename Fn>
+    void for_each_range(const key_type& lo, const key_type& hi, Fn fn) const {
+        std::vector<std::jthread> workers;
+        for_each_range(lo, hi, std::move(fn), [&workers](auto task) { workers.emplace_back(std::move(task)); });
+    }
+};
+
+#endif // SHARDED_SKIP_LIST_HPP
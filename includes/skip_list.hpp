@@ -11,279 +11,3377 @@
 #ifndef SKIP_LIST_HPP
 #define SKIP_LIST_HPP
 
-#include <vector>
+#include <array>
 #include <memory>
-#include <random>
 #include <stdexcept>
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
+#include <new>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <compare>
+#include <concepts>
+#include <bit>
+#include <cstdint>
+#include <atomic>
+#include <span>
+#include <vector>
+#include <ostream>
+#include <cstring>
+
+#include "epoch_domain.hpp"
 
 /**
- * @class FastList
- * @brief A template class that implements a Skip List.
+ * @class skip_list_node_pool
+ * @brief A size-class memory pool that serves node blocks for skip_list.
+ *
+ * Blocks are carved out of large slabs obtained through an allocator that follows
+ * the `std::allocator_traits` conventions. A freed block is threaded onto the free
+ * list of its size class (one class per tower height) and handed out again to the
+ * next node of the same height, so steady-state churn never reaches the allocator.
+ * All slabs are returned at once by release().
+ *
+ * Slabs are grouped into reference-counted arenas, so pools can share memory: after
+ * share(), blocks of the shared arenas may be freed into either pool, and an arena is
+ * returned to the allocator once the last pool referencing it is released. Each pool
+ * only ever grows an arena no other pool references, so pools sharing arenas can be
+ * used from different threads.
+ *
+ * @tparam Allocator The allocator slabs are obtained from; it is rebound to a unit of `BlockAlign` bytes.
+ * @tparam BlockAlign The alignment (and granularity) of every block handed out by the pool.
+ * @tparam SizeClasses The number of distinct size classes (free lists) the pool maintains.
+ */
+template<typename Allocator, std::size_t BlockAlign, int SizeClasses>
+class skip_list_node_pool {
+    static_assert(BlockAlign >= alignof(void*), "Blocks must be able to hold a free-list link.");
+
+    struct alignas(BlockAlign) unit {
+        unsigned char bytes[BlockAlign];
+    };
+
+    using unit_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<unit>;
+    using unit_traits    = std::allocator_traits<unit_allocator>;
+    using unit_pointer   = typename unit_traits::pointer;
+
+    /// @brief A link stored inside a freed block.
+    struct free_block {
+        free_block* next;
+    };
+
+    /// @brief Bookkeeping placed at the start of every slab.
+    struct slab_header {
+        slab_header* next;  ///< The previously allocated slab of the same arena.
+        std::size_t units;  ///< The slab size in units, as passed to the allocator.
+    };
+
+    /// @brief A chain of slabs, freed when the last pool referencing it lets go.
+    struct arena {
+        std::atomic<std::size_t> references{1};
+        slab_header* slabs = nullptr; ///< The most recently allocated slab.
+        std::size_t bytes = 0;        ///< The total size of the slabs.
+    };
+
+    using arena_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<arena>;
+    using arena_traits    = std::allocator_traits<arena_allocator>;
+    using arena_list      = std::vector<arena*, typename std::allocator_traits<Allocator>::template rebind_alloc<arena*>>;
+
+    static constexpr std::size_t header_bytes =
+        (sizeof(slab_header) + BlockAlign - 1) / BlockAlign * BlockAlign;
+    static constexpr std::size_t min_slab_bytes = 1024;      ///< Size of the first slab.
+    static constexpr std::size_t max_slab_bytes = 64 * 1024; ///< Slabs stop growing past this size.
+
+    [[no_unique_address]] unit_allocator allocator_; ///< The allocator slabs are obtained from.
+    arena_list arenas_;                       ///< Every referenced arena; new slabs go to the last one.
+    unsigned char* cursor_ = nullptr;         ///< The first unused byte of the current slab.
+    unsigned char* end_ = nullptr;            ///< One past the last byte of the current slab.
+    std::size_t next_slab_bytes_ = min_slab_bytes;
+    free_block* free_lists_[SizeClasses] = {}; ///< One free list per size class.
+
+    /// @brief Rounds a block size up to the pool granularity.
+    static constexpr std::size_t round_up(std::size_t bytes) noexcept {
+        return (bytes + BlockAlign - 1) / BlockAlign * BlockAlign;
+    }
+
+    /// @brief Drops a reference to an arena and frees its slabs if it was the last one.
+    void drop(arena* shared) noexcept {
+        if (shared->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        slab_header* slab = shared->slabs;
+        while (slab) {
+            slab_header* next = slab->next;
+            const std::size_t units = slab->units;
+            unit& first = *reinterpret_cast<unit*>(slab);
+            unit_traits::deallocate(allocator_, std::pointer_traits<unit_pointer>::pointer_to(first), units);
+            slab = next;
+        }
+        arena_allocator arenas(allocator_);
+        arena_traits::destroy(arenas, shared);
+        arena_traits::deallocate(arenas, shared, 1);
+    }
+
+    /// @brief Moves the slabs of an arena no other pool references into `own`, then frees it.
+    void absorb(arena& own, arena* spliced) noexcept {
+        if (slab_header* first = spliced->slabs) {
+            slab_header* last = first;
+            while (last->next) {
+                last = last->next;
+            }
+            last->next = own.slabs;
+            own.slabs = first;
+            own.bytes += spliced->bytes;
+        }
+        arena_allocator arenas(allocator_);
+        arena_traits::destroy(arenas, spliced);
+        arena_traits::deallocate(arenas, spliced, 1);
+    }
+
+    /**
+     * @brief Allocates a new slab large enough to hold at least one block of `bytes`.
+     * @param bytes The (rounded) size of the block that triggered the growth.
+     */
+    void grow(std::size_t bytes) {
+        // Only this pool may hold a reference of its own to a count of 1, so the relaxed read is exact then.
+        if (arenas_.empty() || arenas_.back()->references.load(std::memory_order_relaxed) != 1) {
+            arenas_.reserve(arenas_.size() + 1);
+            arena_allocator arenas(allocator_);
+            arena* fresh = arena_traits::allocate(arenas, 1);
+            arena_traits::construct(arenas, fresh);
+            arenas_.push_back(fresh);
+        }
+
+        const std::size_t slab_bytes = std::max(next_slab_bytes_, header_bytes + bytes);
+        const std::size_t units = (slab_bytes + BlockAlign - 1) / BlockAlign;
+        unit* memory = std::to_address(unit_traits::allocate(allocator_, units));
+
+        auto* base = reinterpret_cast<unsigned char*>(memory);
+        arena& current = *arenas_.back();
+        current.slabs = ::new (static_cast<void*>(base)) slab_header{current.slabs, units};
+        current.bytes += units * BlockAlign;
+        cursor_ = base + header_bytes;
+        end_ = base + units * BlockAlign;
+        next_slab_bytes_ = std::min(next_slab_bytes_ * 2, max_slab_bytes);
+    }
+
+public:
+    /**
+     * @brief Constructs an empty pool.
+     * @param alloc The allocator slabs are obtained from.
+     */
+    explicit skip_list_node_pool(const Allocator& alloc = Allocator())
+        : allocator_(alloc), arenas_(typename arena_list::allocator_type(alloc)) {}
+
+    skip_list_node_pool(const skip_list_node_pool&) = delete;
+    skip_list_node_pool& operator=(const skip_list_node_pool&) = delete;
+
+    /// @brief Takes over the slabs and free lists of another pool, which is left empty.
+    skip_list_node_pool(skip_list_node_pool&& other) noexcept
+        : allocator_(other.allocator_), arenas_(other.arenas_.get_allocator()) {
+        swap(other);
+    }
+
+    /// @brief Releases every slab, then takes over those of another pool together with its allocator.
+    skip_list_node_pool& operator=(skip_list_node_pool&& other) noexcept {
+        skip_list_node_pool(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /// @brief Exchanges the slabs, free lists and allocators of two pools.
+    void swap(skip_list_node_pool& other) noexcept {
+        using std::swap;
+        swap(allocator_, other.allocator_);
+        arenas_.swap(other.arenas_);
+        swap(cursor_, other.cursor_);
+        swap(end_, other.end_);
+        swap(next_slab_bytes_, other.next_slab_bytes_);
+        std::swap_ranges(std::begin(free_lists_), std::end(free_lists_), std::begin(other.free_lists_));
+    }
+
+    /**
+     * @brief Takes over every slab and free block of another pool, which is left empty.
+     *
+     * Blocks handed out by `other` stay valid and are deallocated into this pool from now
+     * on. Both pools must use equal allocators. The slabs of arenas only `other` references
+     * are moved into an arena of this pool; shared arenas are referenced instead, once, so
+     * splicing back a pool split off with share() leaves the arena table as it was. Costs
+     * O(1) per slab and per free block of `other` plus a scan of the arena table per shared
+     * arena, and allocates nothing unless new arenas are shared.
+     * @param other The pool to empty into this one.
+     * @throw std::bad_alloc If the references to shared arenas cannot be stored; nothing changes then.
+     */
+    void splice(skip_list_node_pool& other) {
+        if (arenas_.empty()) {
+            swap(other);
+            return;
+        }
+        arena* own = arenas_.back()->references.load(std::memory_order_relaxed) == 1 ? arenas_.back() : nullptr;
+        const auto exclusive = [](const arena* candidate) {
+            return candidate->references.load(std::memory_order_relaxed) == 1;
+        };
+        const auto referenced = [this](const arena* candidate) {
+            return std::find(arenas_.begin(), arenas_.end(), candidate) != arenas_.end();
+        };
+        const auto added = std::count_if(other.arenas_.begin(), other.arenas_.end(), [&](const arena* candidate) {
+            return !(own && exclusive(candidate)) && !referenced(candidate);
+        });
+        arenas_.reserve(arenas_.size() + static_cast<std::size_t>(added));
+
+        for (arena* spliced : other.arenas_) {
+            if (own && exclusive(spliced)) {
+                absorb(*own, spliced);
+            } else if (referenced(spliced)) {
+                spliced->references.fetch_sub(1, std::memory_order_relaxed); // Ours keeps it alive.
+            } else {
+                arenas_.insert(arenas_.begin(), spliced);
+            }
+        }
+        other.arenas_.clear();
+
+        if (other.end_ - other.cursor_ > end_ - cursor_) {
+            cursor_ = other.cursor_; // Keep carving from whichever slab has more room left.
+            end_ = other.end_;
+        }
+        next_slab_bytes_ = std::max(next_slab_bytes_, other.next_slab_bytes_);
+
+        for (int size_class = 0; size_class < SizeClasses; ++size_class) {
+            if (free_block* first = other.free_lists_[size_class]) {
+                free_block* tail = first;
+                while (tail->next) {
+                    tail = tail->next;
+                }
+                tail->next = free_lists_[size_class];
+                free_lists_[size_class] = first;
+            }
+        }
+        other.release();
+    }
+
+    /**
+     * @brief Makes this pool a co-owner of every slab of another pool.
+     *
+     * Blocks handed out by `other` may then be deallocated into either pool, and both
+     * keep growing into arenas of their own. Both pools must use equal allocators.
+     * Costs O(1) per arena of `other`.
+     * @param other The pool to share the slabs of.
+     * @throw std::bad_alloc If the arena references cannot be stored; nothing changes then.
+     */
+    void share(const skip_list_node_pool& other) {
+        arenas_.insert(arenas_.begin(), other.arenas_.begin(), other.arenas_.end());
+        for (arena* shared : other.arenas_) {
+            shared->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Returns every slab to the allocator, except those another pool still shares.
+    ~skip_list_node_pool() { release(); }
+
+    /// @brief Returns a copy of the allocator slabs are obtained from.
+    unit_allocator get_allocator() const { return allocator_; }
+
+    /**
+     * @brief Returns the bytes of slab memory the pool references, slab headers included.
+     *
+     * Arenas shared with other pools (see share()) are counted in full by each of them.
+     * Costs O(1) per arena.
+     */
+    std::size_t reserved_bytes() const noexcept {
+        std::size_t bytes = 0;
+        for (const arena* referenced : arenas_) {
+            bytes += referenced->bytes;
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Hands out a block of the given size class.
+     *
+     * The block is reused from the class free list when possible, otherwise it is
+     * carved from the current slab.
+     * @param size_class The index of the block's size class, in `[0, SizeClasses)`.
+     * @param bytes The block size; must be the same for every request of that class.
+     * @return A pointer to uninitialized storage aligned to `BlockAlign`.
+     */
+    void* allocate(int size_class, std::size_t bytes) {
+        if (free_block* block = free_lists_[size_class]) {
+            free_lists_[size_class] = block->next;
+            return block;
+        }
+
+        bytes = round_up(bytes);
+        if (static_cast<std::size_t>(end_ - cursor_) < bytes) {
+            grow(bytes);
+        }
+        void* block = cursor_;
+        cursor_ += bytes;
+        return block;
+    }
+
+    /**
+     * @brief Puts a block back on the free list of its size class.
+     * @param block A block obtained from allocate() with the same size class.
+     * @param size_class The size class the block was allocated with.
+     */
+    void deallocate(void* block, int size_class) noexcept {
+        free_lists_[size_class] = ::new (block) free_block{free_lists_[size_class]};
+    }
+
+    /**
+     * @brief Returns all slabs to the allocator at once, except those another pool still shares.
+     *
+     * Every block handed out by the pool becomes invalid; objects living in them
+     * must have been destroyed beforehand.
+     */
+    void release() noexcept {
+        for (arena* shared : arenas_) {
+            drop(shared);
+        }
+        arena_list(arenas_.get_allocator()).swap(arenas_);
+        cursor_ = end_ = nullptr;
+        next_slab_bytes_ = min_slab_bytes;
+        std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
+    }
+};
+
+/**
+ * @brief Key extractors used to build containers on top of basic_skip_list.
+ */
+namespace skip_list_detail {
+
+/// @brief Uses the whole value as its key (set semantics).
+struct identity_key {
+    template<typename T>
+    const T& operator()(const T& value) const noexcept { return value; }
+};
+
+/// @brief Stands in for the internal finger when Traits::last_access_finger is disabled.
+struct no_finger {};
+
+/// @brief Stands in for the sentinel span widths when Traits::indexed is disabled.
+struct no_spans {};
+
+/// @brief Stands in for the backward pointer and tail when Traits::bidirectional is disabled.
+struct no_link {};
+
+/// @brief Stands in for the retirement hook of a node when Traits::concurrent_readers is disabled.
+struct no_hook {};
+
+/// @brief Stands in for the search counters when Traits::statistics is disabled.
+struct no_statistics {};
+
+/// @brief Stands in for the tower height counters when Traits::level_counts is disabled.
+struct no_level_counts {};
+
+/// @brief Stands in for the epoch domain when Traits::concurrent_readers is disabled.
+struct no_domain {
+    template<typename... Args>
+    constexpr explicit no_domain(Args&&...) noexcept {}
+};
+
+/// @brief Uses the `first` member of a pair as its key (map semantics).
+struct select_first {
+    template<typename Pair>
+    const typename Pair::first_type& operator()(const Pair& value) const noexcept { return value.first; }
+};
+
+/// @brief Hints the CPU to start loading the cache line at `address`; a no-op where unsupported.
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+/**
+ * @brief The prologue of an image written by basic_skip_list::save() and served by skip_list_view.
+ *
+ * It is followed by `height` head links and then by one image_record per element in key
+ * order. Every link is the byte offset of a record from the start of the image, 0 for none.
+ * Images use the byte order and type layout of the writing platform.
+ */
+struct image_header {
+    static constexpr std::array<char, 8> signature{'S', 'K', 'I', 'P', 'L', 'I', 'S', 'T'};
+    static constexpr std::uint32_t current_version = 1;
+    static constexpr std::uint32_t native_byte_order = 0x01020304;
+
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byte_order;  ///< native_byte_order as stored by the writer.
+    std::uint32_t value_size;  ///< `sizeof` the stored values.
+    std::uint32_t value_align; ///< `alignof` the stored values.
+    std::uint32_t height;      ///< The number of head links, the height of the tallest tower.
+    std::uint32_t reserved;
+    std::uint64_t count;       ///< The number of records.
+    std::uint64_t bytes;       ///< The size of the whole image.
+};
+
+/// @brief The layout of one element in an image: the value, then one link per tower level.
+template<typename Value>
+struct image_record {
+    static constexpr std::size_t alignment = std::max(alignof(std::uint64_t), alignof(Value));
+    static constexpr std::size_t links_offset = (sizeof(Value) + 7) / 8 * 8;
+
+    /// @brief Returns the size of a record with `height` links, padded so the next one stays aligned.
+    static constexpr std::size_t size(std::size_t height) noexcept {
+        return (links_offset + 8 * height + alignment - 1) / alignment * alignment;
+    }
+
+    /// @brief Returns the offset of the first record behind the header and `height` head links.
+    static constexpr std::size_t first(std::size_t height) noexcept {
+        return (sizeof(image_header) + 8 * height + alignment - 1) / alignment * alignment;
+    }
+};
+
+} // namespace skip_list_detail
+
+/**
+ * @class xorshift_level_generator
+ * @brief A tiny, seedable xorshift64* generator used to draw tower heights.
+ *
+ * Its whole state is one 64-bit word and constructing it performs no system call,
+ * so an empty list costs almost nothing to create. Lists built with the same seed
+ * and fed the same operations produce identical towers, which keeps tests and
+ * benchmarks repeatable.
+ */
+class xorshift_level_generator {
+    std::uint64_t state_;
+
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t default_seed = 0x9E3779B97F4A7C15ull; ///< Seed used by the default constructor.
+
+    /**
+     * @brief Constructs a generator from a seed.
+     * @param seed Any value; it is scrambled so that small or zero seeds still give a good sequence.
+     */
+    explicit xorshift_level_generator(std::uint64_t seed = default_seed) noexcept
+        : state_(scramble(seed)) {}
+
+    /// @brief Returns 64 uniformly distributed random bits.
+    std::uint64_t operator()() noexcept {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1Dull;
+    }
+
+private:
+    /// @brief Maps a seed to a non-zero state with the splitmix64 finalizer.
+    static constexpr std::uint64_t scramble(std::uint64_t seed) noexcept {
+        seed += 0x9E3779B97F4A7C15ull;
+        seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+        seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+        seed ^= seed >> 31;
+        return seed ? seed : default_seed;
+    }
+};
+
+/**
+ * @class thread_local_level_generator
+ * @brief A stateless level generator that draws from one xorshift generator per thread.
+ *
+ * Lists using it carry no generator state at all, which suits programs creating
+ * millions of small lists. Each thread's generator starts from a seed derived from
+ * the order in which threads first draw, so single-threaded runs stay repeatable.
+ */
+class thread_local_level_generator {
+    /// @brief Returns the calling thread's generator.
+    static xorshift_level_generator& engine() noexcept {
+        static std::atomic<std::uint64_t> next_thread{0};
+        thread_local xorshift_level_generator generator(
+            xorshift_level_generator::default_seed + next_thread.fetch_add(1, std::memory_order_relaxed));
+        return generator;
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    /// @brief Uses the calling thread's generator as it is.
+    thread_local_level_generator() noexcept = default;
+
+    /**
+     * @brief Reseeds the calling thread's generator.
+     * @param seed The new seed; every list drawing on this thread is affected.
+     */
+    explicit thread_local_level_generator(std::uint64_t seed) noexcept {
+        engine() = xorshift_level_generator(seed);
+    }
+
+    /// @brief Returns 64 uniformly distributed random bits from the calling thread's generator.
+    std::uint64_t operator()() const noexcept { return engine()(); }
+};
+
+/**
+ * @brief Selects how bulk builds such as basic_skip_list::insert_sorted() choose tower heights.
+ */
+enum class tower_heights {
+    random,  ///< Draw every height from the level generator, like insert() does.
+    balanced ///< Derive heights from element positions, giving a perfectly balanced list.
+};
+
+/**
+ * @brief The memory held by a skip list, in bytes, see basic_skip_list::memory_usage().
+ */
+struct skip_list_memory_usage {
+    std::size_t container = 0; ///< The list object itself, sentinel tower included.
+    std::size_t nodes = 0;     ///< The element nodes without their towers: values, heights and back links.
+    std::size_t towers = 0;    ///< The forward pointers of the element towers, and their span widths if indexed.
+    std::size_t slack = 0;     ///< Pool memory holding no linked node: free blocks, slab headers and unused slab tails.
+
+    /// @brief Returns the sum of all parts.
+    std::size_t total() const noexcept { return container + nodes + towers + slack; }
+};
+
+/**
+ * @struct skip_list_traits
+ * @brief Compile-time tuning knobs of basic_skip_list.
+ *
+ * Derive from this struct and override only the members that need to change:
+ * @code
+ * struct deep_sparse_traits : skip_list_traits {
+ *     static constexpr int max_height = 40;
+ *     static constexpr int promotion_shift = 2; // p = 1/4
+ * };
+ * skip_list<int, std::less<int>, std::allocator<int>, deep_sparse_traits> list;
+ * @endcode
+ */
+struct skip_list_traits {
+    /// The maximum tower height. With p = 1/2, 32 levels keep searches logarithmic
+    /// for lists of up to about 4 billion elements.
+    static constexpr int max_height = 32;
+
+    /// The promotion probability is `p = 1 / 2^promotion_shift`: 1 gives p = 1/2,
+    /// 2 gives p = 1/4 (fewer pointers per node, slightly longer searches).
+    static constexpr int promotion_shift = 1;
+
+    /// The source of random bits for tower heights. It must be default-constructible,
+    /// constructible from a `std::uint64_t` seed, and return 64 random bits from `operator()`.
+    /// xorshift_level_generator keeps 8 bytes of state per list; thread_local_level_generator
+    /// keeps none.
+    using level_generator = xorshift_level_generator;
+
+    /// When `true`, insert(), emplace() and erase() start every search from the path of the
+    /// previous mutation (an internal "last access" finger), so near-sorted workloads cost
+    /// O(log d) per operation, d being the distance to the previously touched key.
+    static constexpr bool last_access_finger = false;
+
+    /// When `true`, every forward pointer also stores its span width (the number of level-0
+    /// steps it skips), enabling O(log n) rank(), nth(), at(index) and advance(). Disabled,
+    /// nodes carry no extra word and no span is maintained.
+    static constexpr bool indexed = false;
+
+    /// When `true`, every node also keeps a level-0 backward pointer and the list tracks its
+    /// last node, making the iterator bidirectional and enabling rbegin(), back() and pop_back().
+    static constexpr bool bidirectional = false;
+
+    /// When `true`, one writer thread may mutate the list while any number of threads run
+    /// contains(), find(), lower_bound(), upper_bound(), equal_range(), contains_batch(),
+    /// find_batch() and iteration without a lock. Forward pointers are published with release stores and read with acquire
+    /// loads, and erased nodes are freed only after every reader that could see them has
+    /// left its read_lock() section. Disabled, links are plain pointers and frees immediate.
+    static constexpr bool concurrent_readers = false;
+
+    /// When `true`, the list counts the searches run by insert(), erase(), contains(),
+    /// find(), the bound lookups and the batch lookups, their key comparisons and forward
+    /// hops per level, rejected duplicate insertions and height changes, see
+    /// basic_skip_list::statistics(). Disabled, the counters take no space and no instruction.
+    /// Combined with concurrent_readers, every comparison is a relaxed atomic increment of
+    /// counters all readers share, so the readers contend on those cache lines and stop
+    /// scaling: enable both only to diagnose, not in production.
+    static constexpr bool statistics = false;
+
+    /// When `true`, the list keeps the number of towers of every height up to date, so
+    /// basic_skip_list::level_histogram() costs O(max_height) instead of a walk of the upper
+    /// levels. Disabled, the `max_height` counters take no space and no instruction.
+    static constexpr bool level_counts = false;
+};
+
+template<typename Value, typename KeyOfValue, typename Compare, typename Allocator>
+class basic_frozen_skip_list; // Defined in frozen_skip_list.hpp.
+
+/**
+ * @class basic_skip_list
+ * @brief The Skip List engine shared by skip_list and skip_map.
  *
  * This class provides logarithmic time complexity on average for search,
  * insertion, and removal operations. It is an alternative to balanced trees.
  *
- * @tparam KeyType The type of elements stored in the list. It must support copy construction and comparison operators.
+ * Nodes are served by a skip_list_node_pool, so clear() and the destructor return
+ * whole slabs to the allocator instead of freeing nodes one by one.
+ *
+ * @tparam Value The type of elements stored in the list.
+ * @tparam KeyOfValue A function object extracting the ordering key from a stored value.
+ * @tparam Compare A strict weak ordering on keys. If it declares `is_transparent`,
+ *         lookups accept any type comparable with the key.
+ * @tparam Allocator The allocator node memory is obtained from. It follows the `std::allocator_traits` conventions.
+ * @tparam Traits Compile-time tuning knobs, see skip_list_traits.
  */
-template<typename KeyType>
-class skip_list {
-    static_assert(std::is_copy_constructible_v<KeyType>, "KeyType must be copy-constructible.");
+template<typename Value, typename KeyOfValue, typename Compare, typename Allocator, typename Traits>
+class basic_skip_list {
+    static_assert(Traits::max_height >= 1 && Traits::max_height <= 64, "max_height must be in [1, 64].");
+    static_assert(Traits::promotion_shift >= 1 && Traits::promotion_shift <= 63, "promotion_shift must be in [1, 63].");
+
+public:
+    using key_type       = std::remove_cv_t<std::remove_reference_t<
+                               std::invoke_result_t<const KeyOfValue&, const Value&>>>;
+    using value_type     = Value;
+    using key_compare    = Compare;
+    using allocator_type = Allocator;
+    using size_type      = std::size_t;
+    using level_generator = typename Traits::level_generator;
+
+    /// The number of elements of every tower height; entry `h - 1` counts the towers of height `h`.
+    using height_counts_type = std::array<size_type, Traits::max_height>;
+
+    template<bool IsConst> class basic_iterator;
+
+    /// Elements of a set are their own keys, so its iterator is constant like its const_iterator;
+    /// a map's iterator gives mutable access to the mapped part of each pair.
+    using iterator               = std::conditional_t<std::is_same_v<key_type, Value>,
+                                                      basic_iterator<true>, basic_iterator<false>>;
+    using const_iterator         = basic_iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+protected:
+    /**
+     * @struct SkipNode
+     * @brief Represents a node within the FastList.
+     *
+     * Each node stores a value followed by an inline tower of pointers to subsequent
+     * nodes at different levels, enabling the skip-ahead functionality of the list.
+     * The node and its tower live in a single allocation of `node_size(height)` bytes,
+     * so a level hop costs exactly one pointer dereference.
+     */
+    struct alignas(Value) alignas(void*) SkipNode
+        : std::conditional_t<Traits::concurrent_readers, epoch_hook, skip_list_detail::no_hook> {
+        Value value; ///< The data payload of the node.
+        int height;  ///< The number of forward pointers trailing the node.
+        /// The previous node on level 0 (`nullptr` for the first one); bidirectional lists only.
+        [[no_unique_address]] std::conditional_t<Traits::bidirectional, SkipNode*, skip_list_detail::no_link> backward;
+
+        /**
+         * @brief Constructs a new SkipNode.
+         * @param level The number of forward pointers (height of the node).
+         * @param args The arguments the stored value is constructed from.
+         */
+        template<typename... Args>
+        explicit SkipNode(int level, Args&&... args) : value(std::forward<Args>(args)...), height(level) {}
+
+        /// @brief Returns the tower of forward pointers stored right after the node.
+        SkipNode** forward() noexcept { return reinterpret_cast<SkipNode**>(this + 1); }
+
+        /// @brief Returns the span widths trailing the tower (indexed lists only).
+        size_type* spans() noexcept { return reinterpret_cast<size_type*>(forward() + height); }
+    };
+
+    static constexpr bool uses_spans = Traits::indexed;
+    static constexpr bool uses_backward = Traits::bidirectional;
+    static constexpr bool uses_rcu = Traits::concurrent_readers;
+    static constexpr bool uses_level_counts = Traits::level_counts;
+    static_assert(alignof(size_type) <= alignof(SkipNode*), "Span widths must fit the tower alignment.");
+
+    /**
+     * @brief Computes the size of the memory block holding a node and its tower.
+     * @param height The number of forward pointers of the node.
+     */
+    static constexpr std::size_t node_size(int height) noexcept {
+        constexpr std::size_t per_level = sizeof(SkipNode*) + (uses_spans ? sizeof(size_type) : 0);
+        return sizeof(SkipNode) + static_cast<std::size_t>(height) * per_level;
+    }
+
+    static constexpr int MAX_HEIGHT = Traits::max_height; ///< Defines the maximum possible height for any node.
+    static constexpr int PROMOTION_SHIFT = Traits::promotion_shift; ///< Encodes the promotion probability `1 / 2^PROMOTION_SHIFT`.
+
+    using node_pool = skip_list_node_pool<Allocator, alignof(SkipNode), MAX_HEIGHT>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using tower_ptr = SkipNode**; ///< Points at the first forward pointer of a tower.
+
+    /// Fixed-size, on-stack storage for the towers visited by a descent. Only the levels
+    /// below `current_height_` are written by a search; link_node() fills the rest.
+    using update_path_type = std::array<tower_ptr, MAX_HEIGHT>;
+
+public:
+    /**
+     * @class finger
+     * @brief A saved search path that lets the next nearby search start where the last one ended.
+     *
+     * Pass the same finger to consecutive insert(finger&, ...) and find(finger&, ...) calls:
+     * each search first climbs from the recorded position until the key is bracketed and
+     * then descends, costing O(log d) for a key at distance d from the previous one.
+     * A finger is only trusted while the list has not been modified by other means since
+     * it was last used; otherwise the search silently starts from the sentinel head.
+     */
+    class finger {
+        friend class basic_skip_list;
+
+        std::array<SkipNode*, MAX_HEIGHT> predecessors_{}; ///< The last node before the key on each level; `nullptr` is the head.
+        const basic_skip_list* owner_ = nullptr;           ///< The list the path belongs to.
+        std::size_t version_ = 0;                          ///< The list modification count the path is valid for.
+
+    public:
+        /// @brief Constructs an empty finger; its first search starts from the sentinel head.
+        finger() = default;
+    };
+
+    /**
+     * @class node_type
+     * @brief Owns an element taken out of a list by extract(), together with its node.
+     *
+     * The node stays in the memory pool of the list it came from, so putting it back with
+     * insert(node_type&&) allocates nothing; inserting it into another list moves the value
+     * into a node of that list. A handle must be inserted or destroyed before its list is
+     * destroyed, cleared, assigned to or swapped. Merging its list into another one keeps
+     * the handle valid, and so does concatenating it: the pool memory is then shared
+     * instead of handed over.
+     */
+    class node_type {
+        friend class basic_skip_list;
+
+        SkipNode* node_ = nullptr;              ///< The extracted node, `nullptr` when empty.
+        basic_skip_list* owner_ = nullptr;      ///< The list whose pool holds the node.
+
+        node_type(SkipNode* node, basic_skip_list* owner) noexcept : node_(node), owner_(owner) {
+            ++owner_->extracted_nodes_;
+        }
+
+        /// @brief Destroys the held node, if any.
+        void reset() noexcept {
+            if (node_) {
+                --owner_->extracted_nodes_;
+                owner_->destroy_node(std::exchange(node_, nullptr));
+            }
+        }
+
+    public:
+        /// @brief Constructs an empty handle.
+        node_type() = default;
+
+        node_type(const node_type&) = delete;
+        node_type& operator=(const node_type&) = delete;
+
+        /// @brief Takes over the node of another handle, which is left empty.
+        node_type(node_type&& other) noexcept : node_(std::exchange(other.node_, nullptr)), owner_(other.owner_) {}
+
+        /// @brief Destroys the held node, then takes over the node of another handle.
+        node_type& operator=(node_type&& other) noexcept {
+            if (this != &other) {
+                reset();
+                node_ = std::exchange(other.node_, nullptr);
+                owner_ = other.owner_;
+            }
+            return *this;
+        }
+
+        /// @brief Destroys the held element and returns its node to the pool it came from.
+        ~node_type() { reset(); }
+
+        /// @brief Checks whether the handle holds no element.
+        [[nodiscard]] bool empty() const noexcept { return node_ == nullptr; }
+
+        /// @brief Checks whether the handle holds an element.
+        explicit operator bool() const noexcept { return node_ != nullptr; }
+
+        /**
+         * @brief Returns the held element. The handle must not be empty.
+         *
+         * Unlike in a list, the element may be modified: a set's key can be changed
+         * before the node is inserted again.
+         */
+        value_type& value() const noexcept { return node_->value; }
+    };
+
+    /// @brief The result of insert(node_type&&), like the standard containers' `insert_return_type`.
+    struct insert_return_type {
+        iterator position; ///< The inserted element, or the one that prevented the insertion.
+        bool inserted;     ///< Whether the node was inserted.
+        node_type node;    ///< The node given back when it was not inserted, empty otherwise.
+    };
+
+    /// @brief A snapshot of the search counters of a list, see statistics() (Traits::statistics only).
+    struct statistics_type {
+        std::uint64_t searches = 0;          ///< Descents run to locate a key.
+        std::uint64_t comparisons = 0;       ///< Key comparisons made by those descents.
+        std::uint64_t duplicate_inserts = 0; ///< Insertions rejected because the key was present.
+        std::uint64_t height_grows = 0;      ///< Times the list height increased.
+        std::uint64_t height_shrinks = 0;    ///< Times the list height decreased.
+        std::array<std::uint64_t, MAX_HEIGHT> level_hops{}; ///< Forward pointers followed on every level.
+    };
+
+protected:
+    static constexpr bool uses_last_access = Traits::last_access_finger;
+    static constexpr bool uses_statistics = Traits::statistics;
+
+    /// @brief Increments a statistics counter; relaxed atomic when readers may count concurrently.
+    static void bump(std::uint64_t& counter) noexcept {
+        if constexpr (uses_rcu) {
+            std::atomic_ref<std::uint64_t>(counter).fetch_add(1, std::memory_order_relaxed);
+        } else {
+            ++counter;
+        }
+    }
+
+    /// @brief Counts a descent (Traits::statistics only).
+    void count_search() const noexcept {
+        if constexpr (uses_statistics) {
+            bump(statistics_.searches);
+        }
+    }
+
+    /// @brief Counts a key comparison (Traits::statistics only).
+    void count_comparison() const noexcept {
+        if constexpr (uses_statistics) {
+            bump(statistics_.comparisons);
+        }
+    }
+
+    /// @brief Counts a forward hop on a level (Traits::statistics only).
+    void count_hop([[maybe_unused]] int level) const noexcept {
+        if constexpr (uses_statistics) {
+            bump(statistics_.level_hops[level]);
+        }
+    }
+
+    /// @brief Counts an insertion rejected as a duplicate (Traits::statistics only).
+    void count_duplicate() const noexcept {
+        if constexpr (uses_statistics) {
+            bump(statistics_.duplicate_inserts);
+        }
+    }
+
+    /// @brief Returns the tower of a node, or the sentinel tower for `nullptr`.
+    tower_ptr tower_of(SkipNode* node) const noexcept { return node ? node->forward() : head_tower(); }
+
+    /// @brief Returns the ordering key of a stored value.
+    static const key_type& key_of(const Value& value) noexcept { return KeyOfValue{}(value); }
+
+    /**
+     * @brief Allocates a node together with its tower of null forward pointers.
+     * @param height The number of forward pointers of the node.
+     * @param args The arguments the stored value is constructed from.
+     */
+    template<typename... Args>
+    SkipNode* create_node(int height, Args&&... args) {
+        void* memory = pool_.allocate(height - 1, node_size(height));
+        SkipNode* node;
+        try {
+            node = ::new (memory) SkipNode(height, std::forward<Args>(args)...);
+        } catch (...) {
+            pool_.deallocate(memory, height - 1);
+            throw;
+        }
+        std::uninitialized_fill_n(node->forward(), height, nullptr);
+        return node;
+    }
+
+    /**
+     * @brief Destroys a node created by create_node() and returns its block to the pool.
+     * @param node The node to destroy.
+     */
+    void destroy_node(SkipNode* node) noexcept {
+        const int height = node->height;
+        node->~SkipNode();
+        pool_.deallocate(node, height - 1);
+    }
+
+    /**
+     * @brief Destroys every element without releasing node memory.
+     *
+     * Used right before the pool releases its slabs; a no-op for trivially destructible values.
+     */
+    void destroy_all_values() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<Value>) {
+            SkipNode* current = sentinel_head_[0];
+            while (current) {
+                SkipNode* next = current->forward()[0];
+                current->~SkipNode();
+                current = next;
+            }
+        }
+    }
+
+    /// @brief Returns the sentinel tower, which search loops treat like the tower of a node.
+    tower_ptr head_tower() const noexcept { return const_cast<tower_ptr>(sentinel_head_.data()); }
+
+    /// @brief Returns the node a tower belongs to, or `nullptr` for the sentinel tower.
+    SkipNode* node_of(tower_ptr tower) const noexcept {
+        return tower == head_tower() ? nullptr : reinterpret_cast<SkipNode*>(tower) - 1;
+    }
+
+    /**
+     * @brief Returns the span widths belonging to a tower (indexed lists only).
+     *
+     * `spans_of(t)[i]` is the rank distance from the owner of `t` to `t[i]`. The width of a
+     * null forward pointer is unspecified and never read.
+     */
+    size_type* spans_of(tower_ptr tower) const noexcept requires uses_spans {
+        SkipNode* node = node_of(tower);
+        return node ? node->spans() : const_cast<size_type*>(head_spans_.data());
+    }
+
+    /// @brief Returns an iterator to a node (or `end()` for `nullptr`) of this list.
+    iterator make_iterator(SkipNode* node) noexcept { return iterator(node, this); }
+
+    /// @copydoc make_iterator(SkipNode*)
+    const_iterator make_iterator(SkipNode* node) const noexcept { return const_iterator(node, this); }
+
+    /// @brief Drops the empty levels at the top after an erase.
+    void trim_height() noexcept {
+        int height = current_height_;
+        while (height > 0 && sentinel_head_[height - 1] == nullptr) {
+            --height;
+        }
+        store_height(height);
+    }
+
+    /**
+     * @brief Reads the forward pointer a reader follows; an acquire load with concurrent readers.
+     * @param tower The tower to read from.
+     * @param level The level of the pointer.
+     */
+    static SkipNode* load_link(tower_ptr tower, int level) noexcept {
+        if constexpr (uses_rcu) {
+            return std::atomic_ref<SkipNode*>(tower[level]).load(std::memory_order_acquire);
+        } else {
+            return tower[level];
+        }
+    }
+
+    /**
+     * @brief Writes a forward pointer of a linked tower; a release store with concurrent readers,
+     *        so a reader that follows it also sees the node's value and lower links.
+     * @param tower The tower to write to.
+     * @param level The level of the pointer.
+     * @param node The new target.
+     */
+    static void store_link(tower_ptr tower, int level, SkipNode* node) noexcept {
+        if constexpr (uses_rcu) {
+            std::atomic_ref<SkipNode*>(tower[level]).store(node, std::memory_order_release);
+        } else {
+            tower[level] = node;
+        }
+    }
+
+    /// @brief Reads the height a reader descends from.
+    int load_height() const noexcept {
+        if constexpr (uses_rcu) {
+            return std::atomic_ref<int>(const_cast<int&>(current_height_)).load(std::memory_order_relaxed);
+        } else {
+            return current_height_;
+        }
+    }
+
+    /// @brief Sets the list height; levels above it are empty, so readers may see either value.
+    void store_height(int height) noexcept {
+        if constexpr (uses_statistics) {
+            if (height != current_height_) {
+                bump(height > current_height_ ? statistics_.height_grows : statistics_.height_shrinks);
+            }
+        }
+        if constexpr (uses_rcu) {
+            std::atomic_ref<int>(current_height_).store(height, std::memory_order_relaxed);
+        } else {
+            current_height_ = height;
+        }
+    }
+
+    /// @brief Frees an unlinked node, or defers it past the current readers with concurrent readers.
+    void dispose_node(SkipNode* node) noexcept {
+        if constexpr (uses_rcu) {
+            domain_.pin().retire(node);
+        } else {
+            destroy_node(node);
+        }
+    }
+
+    /// @brief Pins the calling reader for one lookup with concurrent readers; a no-op otherwise.
+    auto pin_reader() const {
+        if constexpr (uses_rcu) {
+            return domain_.pin();
+        } else {
+            return skip_list_detail::no_domain{};
+        }
+    }
+
+    /// @brief Frees every node still waiting for its grace period; no reader may be running.
+    void reclaim_retired() noexcept {
+        if constexpr (uses_rcu) {
+            domain_.reclaim_all();
+        }
+    }
+
+    /**
+     * @brief Exchanges the elements, node memory and level generators of two lists.
+     *
+     * Retired nodes are freed first, so no domain is left holding a node of the other pool.
+     * Both modification counts are bumped, which turns every finger into either list stale.
+     * @param other The list to exchange contents with.
+     */
+    void swap_contents(basic_skip_list& other) noexcept {
+        reclaim_retired();
+        other.reclaim_retired();
+        using std::swap;
+        pool_.swap(other.pool_);
+        swap(sentinel_head_, other.sentinel_head_);
+        swap(current_height_, other.current_height_);
+        swap(element_count_, other.element_count_);
+        swap(tower_links_, other.tower_links_);
+        swap(height_counts_, other.height_counts_);
+        swap(random_engine_, other.random_engine_);
+        swap(tail_, other.tail_);
+        swap(head_spans_, other.head_spans_);
+        ++modification_count_;
+        ++other.modification_count_;
+    }
+
+    /// @brief Hands a node whose grace period is over back to the pool.
+    static void reclaim_node(void* list, epoch_hook* node) noexcept {
+        if constexpr (uses_rcu) {
+            static_cast<basic_skip_list*>(list)->destroy_node(static_cast<SkipNode*>(node));
+        }
+    }
+
+    [[no_unique_address]] Compare comp_; ///< The ordering applied to keys.
+    node_pool pool_;          ///< The pool every element node is allocated from.
+    /// The sentinel tower that marks the beginning of the list. It is a bare array of
+    /// forward pointers with no value slot, so an empty list allocates nothing.
+    std::array<SkipNode*, MAX_HEIGHT> sentinel_head_;
+    int current_height_;      ///< The current maximum height among all nodes in the list.
+    size_t element_count_;    ///< The total number of elements currently in the list.
+    size_type tower_links_ = 0; ///< The forward pointers of all linked nodes, see memory_usage().
+    std::size_t modification_count_ = 0; ///< Bumped by every structural change; validates fingers.
+    std::size_t extracted_nodes_ = 0;    ///< The nodes held by node_type handles, which keep pointing into pool_.
+    
+    [[no_unique_address]] level_generator random_engine_; ///< The source of random bits for tower heights.
+
+    /// The path of the last mutation, used only when Traits::last_access_finger is enabled.
+    [[no_unique_address]] std::conditional_t<uses_last_access, finger, skip_list_detail::no_finger> last_access_;
+
+    /// The last node of the list, tracked only when Traits::bidirectional is enabled.
+    [[no_unique_address]] std::conditional_t<uses_backward, SkipNode*, skip_list_detail::no_link> tail_{};
+
+    /// The span widths of the sentinel tower, kept only when Traits::indexed is enabled.
+    [[no_unique_address]] std::conditional_t<uses_spans, std::array<size_type, MAX_HEIGHT>,
+                                             skip_list_detail::no_spans> head_spans_{};
+
+    /// The number of linked towers of every height, kept only when Traits::level_counts is enabled.
+    [[no_unique_address]] std::conditional_t<uses_level_counts, height_counts_type,
+                                             skip_list_detail::no_level_counts> height_counts_{};
+
+    /// The search counters, kept only when Traits::statistics is enabled.
+    [[no_unique_address]] mutable std::conditional_t<uses_statistics, statistics_type,
+                                                     skip_list_detail::no_statistics> statistics_{};
+
+    /// Defers node frees past running readers, used only when Traits::concurrent_readers is enabled.
+    /// Declared last, so retired nodes return to the pool before it is destroyed.
+    [[no_unique_address]] mutable std::conditional_t<uses_rcu, epoch_domain, skip_list_detail::no_domain> domain_;
+
+    /**
+     * @brief Determines a random height for a new node.
+     *
+     * The height is generated from a single 64-bit draw: every run of `PROMOTION_SHIFT`
+     * trailing zero bits promotes the node one level, which happens with probability
+     * `1 / 2^PROMOTION_SHIFT`, until the maximum allowed height is reached.
+     * @return A randomly generated height between 1 and MAX_HEIGHT.
+     */
+    int generateRandomHeight() {
+        const int height = 1 + std::countr_zero(static_cast<std::uint64_t>(random_engine_())) / PROMOTION_SHIFT;
+        return std::min(height, MAX_HEIGHT);
+    }
+
+    /// @brief Checks whether a key found by a search is equivalent to the searched one.
+    template<typename K>
+    bool matches(const SkipNode* node, const K& key) const {
+        return node && !comp_(key, key_of(node->value));
+    }
+
+    /**
+     * @brief Descends from the sentinel head to the first node not less than a key.
+     *
+     * @param key The key to search for.
+     * @param update_path If not null, receives the tower of the last node visited on every level.
+     * @return The first node whose key is not less than `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* search(const K& key, tower_ptr* update_path = nullptr) const {
+        count_search();
+        tower_ptr current = head_tower();
+        for (int i = load_height() - 1; i >= 0; --i) {
+            while (SkipNode* next = load_link(current, i)) {
+                count_comparison();
+                if (!comp_(key_of(next->value), key)) break;
+                count_hop(i);
+                current = next->forward();
+            }
+            if (update_path) update_path[i] = current;
+        }
+        return load_link(current, 0);
+    }
+
+    /**
+     * @brief Tells whether searches for `K` may use a single `operator<=>` per step.
+     *
+     * This holds when the comparator is `std::less` (which orders by `operator<`) and the
+     * stored key is three-way comparable with `K`; every step then learns "less",
+     * "equal" and "greater" from one comparison.
+     */
+    template<typename K>
+    static constexpr bool uses_three_way =
+        (std::is_same_v<Compare, std::less<key_type>> || std::is_same_v<Compare, std::less<>>) &&
+        std::three_way_comparable_with<key_type, K>;
+
+    /**
+     * @brief Finds the node equivalent to a key.
+     *
+     * With the three-way fast path the descent stops at the first level where the key
+     * is met instead of always running down to level 0.
+     * @param key The key to search for.
+     * @return The node holding an equivalent key, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* find_node(const K& key) const {
+        if constexpr (uses_three_way<K>) {
+            count_search();
+            tower_ptr current = head_tower();
+            for (int i = load_height() - 1; i >= 0; --i) {
+                while (SkipNode* next = load_link(current, i)) {
+                    count_comparison();
+                    const auto order = key_of(next->value) <=> key;
+                    if (order == 0) return next;
+                    if (order > 0) break;
+                    count_hop(i);
+                    current = next->forward();
+                }
+            }
+            return nullptr;
+        } else {
+            SkipNode* current = search(key);
+            return matches(current, key) ? current : nullptr;
+        }
+    }
+
+    /**
+     * @brief Finds the node equivalent to a key and records the full update path.
+     *
+     * With the three-way fast path, key comparisons stop at the first level where the key
+     * is met; the remaining levels of the path are completed by following pointers until
+     * they reach the found node.
+     * @param key The key to search for.
+     * @param update_path Receives the tower of the last node before `key` on every level
+     *        below `current_height_`.
+     * @return The node holding an equivalent key, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* locate(const K& key, tower_ptr* update_path) const {
+        if constexpr (uses_three_way<K>) {
+            count_search();
+            tower_ptr current = head_tower();
+            for (int i = current_height_ - 1; i >= 0; --i) {
+                while (SkipNode* next = current[i]) {
+                    count_comparison();
+                    const auto order = key_of(next->value) <=> key;
+                    if (order == 0) {
+                        update_path[i] = current;
+                        for (int j = i - 1; j >= 0; --j) {
+                            while (current[j] != next) {
+                                count_hop(j);
+                                current = current[j]->forward();
+                            }
+                            update_path[j] = current;
+                        }
+                        return next;
+                    }
+                    if (order > 0) break;
+                    count_hop(i);
+                    current = next->forward();
+                }
+                update_path[i] = current;
+            }
+            return nullptr;
+        } else {
+            SkipNode* current = search(key, update_path);
+            return matches(current, key) ? current : nullptr;
+        }
+    }
+
+    /**
+     * @brief Inserts a node constructed from `args` unless `key` is already present.
+     *
+     * @param key The key of the value being inserted.
+     * @param args The arguments the new value is constructed from.
+     * @return The node holding `key` and whether it was newly inserted.
+     */
+    template<typename K, typename... Args>
+    std::pair<SkipNode*, bool> insert_unique(const K& key, Args&&... args) {
+        if constexpr (uses_last_access) {
+            return insert_at_finger(last_access_, key, std::forward<Args>(args)...);
+        }
+
+        update_path_type update_path;
+        if (SkipNode* existing = locate(key, update_path.data())) {
+            count_duplicate();
+            return {existing, false}; // Element already exists
+        }
+
+        SkipNode* newNode = create_node(generateRandomHeight(), std::forward<Args>(args)...);
+        link_node(newNode, update_path.data());
+        return {newNode, true};
+    }
+
+    /**
+     * @brief Inserts an already constructed node unless its key is already present.
+     *
+     * The node is destroyed when an equivalent key exists.
+     * @param newNode A node created by create_node() that is not linked yet.
+     * @return The node holding the key and whether `newNode` was linked.
+     */
+    std::pair<SkipNode*, bool> insert_node(SkipNode* newNode) {
+        update_path_type update_path;
+        if (SkipNode* existing = path_to(key_of(newNode->value), update_path.data())) {
+            count_duplicate();
+            destroy_node(newNode);
+            return {existing, false}; // Element already exists
+        }
+
+        link_position(newNode, update_path.data());
+        return {newNode, true};
+    }
+
+    /**
+     * @brief Records the update path to a key, from the last-access finger if enabled.
+     * @return The node equivalent to `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* path_to(const K& key, tower_ptr* update_path) {
+        if constexpr (uses_last_access) {
+            return finger_path(key, last_access_, update_path);
+        } else {
+            return locate(key, update_path);
+        }
+    }
+
+    /// @brief Links a node at a path found by path_to() and keeps the last-access finger valid.
+    void link_position(SkipNode* newNode, tower_ptr* update_path) noexcept {
+        link_node(newNode, update_path);
+        if constexpr (uses_last_access) {
+            advance_finger(last_access_, newNode);
+        }
+    }
+
+    /**
+     * @brief Searches for a key starting from a finger and records the new path in it.
+     *
+     * The search climbs from level 0 until the finger's node on some level lies before `key`
+     * while its successor does not, then descends from there. A stale finger (another list's,
+     * or one predating a modification) makes the search start from the sentinel head.
+     * @param key The key to search for.
+     * @param hint The finger to start from; receives the path to `key`.
+     * @return The first node whose key is not less than `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* finger_search(const K& key, finger& hint) const {
+        count_search();
+        int level = current_height_;
+        if (hint.owner_ == this && hint.version_ == modification_count_) {
+            for (level = 0; level < current_height_; ++level) {
+                SkipNode* pred = hint.predecessors_[level];
+                if (pred) {
+                    count_comparison();
+                    if (!comp_(key_of(pred->value), key)) continue; // The finger is past the key.
+                }
+                SkipNode* next = tower_of(pred)[level];
+                if (!next) break;
+                count_comparison();
+                if (!comp_(key_of(next->value), key)) break; // The key is bracketed.
+            }
+        } else {
+            std::fill(hint.predecessors_.begin() + current_height_, hint.predecessors_.end(), nullptr);
+        }
+
+        SkipNode* node = level < current_height_ ? hint.predecessors_[level] : nullptr;
+        tower_ptr current = tower_of(node);
+        for (int i = level - 1; i >= 0; --i) {
+            while (current[i]) {
+                count_comparison();
+                if (!comp_(key_of(current[i]->value), key)) break;
+                count_hop(i);
+                node = current[i];
+                current = node->forward();
+            }
+            hint.predecessors_[i] = node;
+        }
+
+        hint.owner_ = this;
+        hint.version_ = modification_count_;
+        return current[0];
+    }
+
+    /// @brief Runs finger_search() and keeps only an equivalent node.
+    template<typename K>
+    SkipNode* finger_find(const K& key, finger& hint) const {
+        SkipNode* found = finger_search(key, hint);
+        return matches(found, key) ? found : nullptr;
+    }
+
+    /**
+     * @brief Runs finger_search() and converts the finger into an update path.
+     * @return The node equivalent to `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* finger_path(const K& key, finger& hint, tower_ptr* update_path) const {
+        SkipNode* found = finger_search(key, hint);
+        for (int i = 0; i < current_height_; ++i) {
+            update_path[i] = tower_of(hint.predecessors_[i]);
+        }
+        return matches(found, key) ? found : nullptr;
+    }
+
+    /**
+     * @brief Moves a finger onto a node that was just linked, keeping the path valid.
+     *
+     * Pointing the lower levels at the new node lets an ascending run of insertions find
+     * its position on level 0 immediately.
+     */
+    void advance_finger(finger& hint, SkipNode* newNode) const noexcept {
+        for (int i = 0; i < newNode->height; ++i) {
+            hint.predecessors_[i] = newNode;
+        }
+        hint.version_ = modification_count_;
+    }
+
+    /**
+     * @brief Inserts a node constructed from `args` at the position found from a finger.
+     * @return The node holding `key` and whether it was newly inserted.
+     */
+    template<typename K, typename... Args>
+    std::pair<SkipNode*, bool> insert_at_finger(finger& hint, const K& key, Args&&... args) {
+        update_path_type update_path;
+        if (SkipNode* existing = finger_path(key, hint, update_path.data())) {
+            count_duplicate();
+            return {existing, false}; // Element already exists
+        }
+
+        SkipNode* newNode = create_node(generateRandomHeight(), std::forward<Args>(args)...);
+        link_node(newNode, update_path.data());
+        advance_finger(hint, newNode);
+        return {newNode, true};
+    }
+
+    /**
+     * @brief Splices a new node in after the nodes of a search's update path.
+     *
+     * @param newNode The node to link; its tower height decides how many levels are touched.
+     * @param update_path The tower of the last node before the new key on every level
+     *        below `current_height_`.
+     */
+    void link_node(SkipNode* newNode, tower_ptr* update_path) noexcept {
+        const int newHeight = newNode->height;
+        if (newHeight > current_height_) {
+            for (int i = current_height_; i < newHeight; ++i) {
+                update_path[i] = head_tower();
+            }
+            store_height(newHeight);
+        }
+
+        size_type distance = 0; // The rank distance from update_path[i] to update_path[0].
+        for (int i = 0; i < newHeight; ++i) {
+            if constexpr (uses_spans) {
+                if (i > 0) {
+                    // Re-walk the short stretch of level i - 1 the search descended through.
+                    for (tower_ptr t = update_path[i]; t != update_path[i - 1]; t = t[i - 1]->forward()) {
+                        distance += spans_of(t)[i - 1];
+                    }
+                }
+                size_type* spans = spans_of(update_path[i]);
+                newNode->spans()[i] = spans[i] - distance;
+                spans[i] = distance + 1;
+            }
+            newNode->forward()[i] = update_path[i][i];
+            store_link(update_path[i], i, newNode);
+        }
+        if constexpr (uses_spans) {
+            for (int i = newHeight; i < current_height_; ++i) {
+                ++spans_of(update_path[i])[i];
+            }
+        }
+        if constexpr (uses_backward) {
+            newNode->backward = node_of(update_path[0]);
+            SkipNode* next = newNode->forward()[0];
+            (next ? next->backward : tail_) = newNode;
+        }
+
+        ++element_count_;
+        count_towers(newNode->height, 1);
+        ++modification_count_;
+    }
+
+    /**
+     * @brief Computes the tower height the `position`-th element (1-based) gets in a perfectly
+     *        balanced list: one level more for every `PROMOTION_SHIFT` trailing zero bits.
+     */
+    static int balanced_height(size_type position) noexcept {
+        const int height = 1 + std::countr_zero(static_cast<std::uint64_t>(position)) / PROMOTION_SHIFT;
+        return std::min(height, MAX_HEIGHT);
+    }
+
+    /**
+     * @brief Walks to the end of every level, recording the last tower of each one.
+     *
+     * @param tail Receives the last tower on every level below `current_height_`.
+     * @return The last node of the list, or `nullptr` if it is empty.
+     */
+    SkipNode* find_tail(tower_ptr* tail) const noexcept {
+        tower_ptr current = head_tower();
+        SkipNode* last = nullptr;
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (current[i]) {
+                last = current[i];
+                current = last->forward();
+            }
+            tail[i] = current;
+        }
+        return last;
+    }
+
+    /**
+     * @brief Fills an empty list with the elements of another one, keeping their tower heights.
+     *
+     * Every node is appended behind the last tower of each level it spans, so the whole
+     * copy is a single O(n) pass that reproduces the source's shape without drawing any
+     * height or comparing any key. Elements are moved out of a non-const source.
+     * @param other The list to take the elements from.
+     */
+    template<typename List>
+    void append_all(List& other) {
+        update_path_type tail;
+        for (SkipNode* node = other.sentinel_head_[0]; node; node = node->forward()[0]) {
+            SkipNode* newNode;
+            if constexpr (std::is_const_v<List>) {
+                newNode = create_node(node->height, node->value);
+            } else {
+                newNode = create_node(node->height, std::move(node->value));
+            }
+            append_node(newNode, tail.data());
+        }
+    }
+
+    /**
+     * @brief Links a node behind the last tower of every level it spans.
+     * @param newNode The node to link; its key must be greater than every key in the list.
+     * @param tail The last tower on every level below `current_height_`; advanced past `newNode`.
+     */
+    void append_node(SkipNode* newNode, tower_ptr* tail) noexcept {
+        link_node(newNode, tail);
+        for (int i = 0; i < newNode->height; ++i) {
+            tail[i] = newNode->forward();
+        }
+    }
+
+    /// @brief Appends a copy of a node of another list, with the same tower height; see append_node().
+    void append_copy(const SkipNode* node, tower_ptr* tail) {
+        append_node(create_node(node->height, node->value), tail);
+    }
+
+    /**
+     * @brief Empties the list without destroying its nodes.
+     * @return The first node of the former level-0 chain, which still links all of them.
+     */
+    SkipNode* detach_all() noexcept {
+        SkipNode* first = sentinel_head_[0];
+        sentinel_head_.fill(nullptr);
+        if constexpr (uses_backward) {
+            tail_ = nullptr;
+        }
+        store_height(0);
+        element_count_ = 0;
+        reset_tower_counts();
+        ++modification_count_;
+        return first;
+    }
+
+    /// @brief Writes a tower counter; a relaxed store with concurrent readers, see level_histogram().
+    static void store_count(size_type& counter, size_type value) noexcept {
+        if constexpr (uses_rcu) {
+            std::atomic_ref<size_type>(counter).store(value, std::memory_order_relaxed);
+        } else {
+            counter = value;
+        }
+    }
+
+    /// @brief Reads a tower counter written by store_count().
+    static size_type load_count(const size_type& counter) noexcept {
+        if constexpr (uses_rcu) {
+            return std::atomic_ref<size_type>(const_cast<size_type&>(counter)).load(std::memory_order_relaxed);
+        } else {
+            return counter;
+        }
+    }
+
+    /**
+     * @brief Accounts for `count` towers of `height` levels joining the list, or leaving it
+     *        when `count` is negative.
+     */
+    void count_towers(int height, std::ptrdiff_t count) noexcept {
+        store_count(tower_links_, tower_links_ + static_cast<size_type>(count * height));
+        if constexpr (uses_level_counts) {
+            size_type& counter = height_counts_[height - 1];
+            store_count(counter, counter + static_cast<size_type>(count));
+        }
+    }
+
+    /// @brief Zeroes the tower accounting of a list that was emptied.
+    void reset_tower_counts() noexcept {
+        store_count(tower_links_, 0);
+        if constexpr (uses_level_counts) {
+            for (size_type& counter : height_counts_) {
+                store_count(counter, 0);
+            }
+        }
+    }
+
+    /**
+     * @brief Counts the nodes of every tower height by walking the levels.
+     *
+     * A level holds `p` times the nodes of the one below, so the walk of the levels above
+     * the lowest visits about `n p / (1 - p)` nodes: n for p = 1/2, n / 3 for p = 1/4.
+     * With concurrent readers the walk reads through load_link() and covers the lowest
+     * level too, since only the writer may read the element count; counts taken beside the
+     * writer then mix levels seen at different times.
+     */
+    height_counts_type count_heights() const noexcept {
+        [[maybe_unused]] const auto section = pin_reader();
+        const int height = load_height();
+        height_counts_type counts{};
+        size_type below = 0; // The number of nodes reaching level i - 1.
+        if constexpr (uses_rcu) {
+            for (SkipNode* node = load_link(head_tower(), 0); node; node = load_link(node->forward(), 0)) {
+                ++below;
+            }
+        } else {
+            below = element_count_;
+        }
+        for (int i = 1; i <= height; ++i) {
+            size_type reaching = 0;
+            if (i < height) {
+                for (SkipNode* node = load_link(head_tower(), i); node; node = load_link(node->forward(), i)) {
+                    ++reaching;
+                }
+            }
+            counts[i - 1] = below > reaching ? below - reaching : 0;
+            below = reaching;
+        }
+        return counts;
+    }
+
+    /// @brief Returns the number of forward pointers the towers counted by `counts` hold.
+    static size_type links_of(const height_counts_type& counts) noexcept {
+        size_type links = 0;
+        for (int h = 1; h <= MAX_HEIGHT; ++h) {
+            links += counts[h - 1] * static_cast<size_type>(h);
+        }
+        return links;
+    }
+
+    /**
+     * @brief Moves the elements not less than `key` into an empty list with an equal allocator.
+     *
+     * A single descent records the last tower before the cut on every level; only the
+     * pointers crossing the cut are rewired, and the two lists share the node memory from
+     * then on (see skip_list_node_pool::share()). On an indexed list the descent also
+     * yields the new sizes and head spans. Otherwise the sizes are found by walking both
+     * halves in lockstep until the shorter one ends, adding O(min(k, n - k)) steps for a
+     * cut after k of n elements. The towers of the shorter half are then counted along
+     * its levels above the lowest one, about min(k, n - k) * p steps.
+     * @param key The first key that moves.
+     * @param tail The list receiving the elements; must be empty.
+     */
+    template<typename K>
+    void split_into(const K& key, basic_skip_list& tail) {
+        tail.pool_.share(pool_);
+
+        update_path_type update_path;
+        [[maybe_unused]] std::array<size_type, MAX_HEIGHT> positions; // Ranks of the path towers, indexed lists only.
+        tower_ptr current = head_tower();
+        size_type position = 0;
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (current[i] && comp_(key_of(current[i]->value), key)) {
+                if constexpr (uses_spans) {
+                    position += spans_of(current)[i];
+                }
+                current = current[i]->forward();
+            }
+            update_path[i] = current;
+            if constexpr (uses_spans) {
+                positions[i] = position;
+            }
+        }
+        SkipNode* first = current_height_ > 0 ? current[0] : nullptr;
+        if (!first) {
+            return;
+        }
+
+        for (int i = 0; i < current_height_; ++i) {
+            SkipNode* next = update_path[i][i];
+            tail.sentinel_head_[i] = next;
+            if constexpr (uses_spans) {
+                if (next) {
+                    tail.head_spans_[i] = positions[i] + spans_of(update_path[i])[i] - position;
+                }
+            }
+            store_link(update_path[i], i, nullptr);
+        }
+        if constexpr (uses_backward) {
+            first->backward = nullptr;
+            tail.tail_ = tail_;
+            tail_ = node_of(update_path[0]);
+        }
+
+        size_type kept = position;
+        if constexpr (!uses_spans) {
+            size_type steps = 0;
+            SkipNode* left = sentinel_head_[0];
+            SkipNode* right = first;
+            while (left && right) {
+                left = left->forward()[0];
+                right = right->forward()[0];
+                ++steps;
+            }
+            kept = left ? element_count_ - steps : steps;
+        }
+        tail.element_count_ = element_count_ - kept;
+        element_count_ = kept;
+
+        tail.current_height_ = current_height_;
+        tail.trim_height();
+        trim_height();
+
+        // Recount the towers of the shorter part; the longer one keeps the rest.
+        basic_skip_list& shorter = tail.element_count_ < element_count_ ? tail : *this;
+        basic_skip_list& longer = &shorter == this ? tail : *this;
+        const height_counts_type counted = shorter.count_heights();
+        const size_type links = links_of(counted);
+        longer.store_count(longer.tower_links_, tower_links_ - links);
+        shorter.store_count(shorter.tower_links_, links);
+        if constexpr (uses_level_counts) {
+            for (int h = 0; h < MAX_HEIGHT; ++h) {
+                longer.store_count(longer.height_counts_[h], height_counts_[h] - counted[h]);
+                shorter.store_count(shorter.height_counts_[h], counted[h]);
+            }
+        }
+        ++tail.modification_count_;
+        ++modification_count_;
+    }
+
+    /**
+     * @brief Fills an empty list with the union of two lists, see set_union().
+     *
+     * Each key of the smaller list is located in the larger one from a forward-moving
+     * finger, and the run of the larger list skipped over is copied without comparisons.
+     */
+    void assign_union(const basic_skip_list& a, const basic_skip_list& b) {
+        const bool a_drives = a.size() <= b.size();
+        const basic_skip_list& small = a_drives ? a : b;
+        const basic_skip_list& large = a_drives ? b : a;
+
+        update_path_type tail;
+        finger hint;
+        SkipNode* run = large.sentinel_head_[0]; // The first node of `large` not copied yet.
+        for (SkipNode* node = small.sentinel_head_[0]; node; node = node->forward()[0]) {
+            SkipNode* stop = large.finger_search(key_of(node->value), hint);
+            for (; run != stop; run = run->forward()[0]) {
+                append_copy(run, tail.data());
+            }
+            if (large.matches(stop, key_of(node->value))) {
+                append_copy(a_drives ? node : stop, tail.data());
+                run = stop->forward()[0];
+            } else {
+                append_copy(node, tail.data());
+            }
+        }
+        for (; run; run = run->forward()[0]) {
+            append_copy(run, tail.data());
+        }
+    }
+
+    /**
+     * @brief Fills an empty list with the intersection of two lists, see set_intersection().
+     *
+     * Only the keys of the smaller list are looked up, from a forward-moving finger.
+     */
+    void assign_intersection(const basic_skip_list& a, const basic_skip_list& b) {
+        const bool a_drives = a.size() <= b.size();
+        const basic_skip_list& small = a_drives ? a : b;
+        const basic_skip_list& large = a_drives ? b : a;
+
+        update_path_type tail;
+        finger hint;
+        for (SkipNode* node = small.sentinel_head_[0]; node; node = node->forward()[0]) {
+            if (SkipNode* found = large.finger_find(key_of(node->value), hint)) {
+                append_copy(a_drives ? node : found, tail.data());
+            }
+        }
+    }
+
+    /**
+     * @brief Fills an empty list with the elements of `a` absent from `b`, see set_difference().
+     *
+     * The smaller list drives the pass as in assign_union().
+     */
+    void assign_difference(const basic_skip_list& a, const basic_skip_list& b) {
+        update_path_type tail;
+        finger hint;
+        if (a.size() <= b.size()) {
+            for (SkipNode* node = a.sentinel_head_[0]; node; node = node->forward()[0]) {
+                if (!b.finger_find(key_of(node->value), hint)) {
+                    append_copy(node, tail.data());
+                }
+            }
+            return;
+        }
+
+        SkipNode* run = a.sentinel_head_[0]; // The first node of `a` not handled yet.
+        for (SkipNode* node = b.sentinel_head_[0]; node; node = node->forward()[0]) {
+            SkipNode* stop = a.finger_search(key_of(node->value), hint);
+            for (; run != stop; run = run->forward()[0]) {
+                append_copy(run, tail.data());
+            }
+            if (a.matches(stop, key_of(node->value))) {
+                run = stop->forward()[0];
+            }
+        }
+        for (; run; run = run->forward()[0]) {
+            append_copy(run, tail.data());
+        }
+    }
+
+    /**
+     * @brief Removes the node equivalent to `key`, if any.
+     */
+    template<typename K>
+    bool erase_key(const K& key) {
+        if constexpr (uses_last_access) {
+            return erase_at_finger(last_access_, key);
+        }
+
+        if (empty()) {
+            return false;
+        }
+
+        update_path_type update_path;
+        SkipNode* current = locate(key, update_path.data());
+        if (!current) {
+            return false; // Element not found
+        }
+
+        unlink_node(current, update_path.data());
+        return true;
+    }
+
+    /// @brief Unlinks the node equivalent to `key`, if any, and wraps it in a handle.
+    template<typename K>
+    node_type extract_key(const K& key) {
+        if (empty()) {
+            return node_type();
+        }
+
+        update_path_type update_path;
+        SkipNode* node = path_to(key, update_path.data());
+        if (!node) {
+            return node_type();
+        }
+        detach_node(node, update_path.data());
+        if constexpr (uses_last_access) {
+            last_access_.version_ = modification_count_; // The predecessors stay in place.
+        }
+        return node_type(node, this);
+    }
+
+    /**
+     * @brief Removes the node equivalent to `key`, searching from a finger.
+     *
+     * The predecessors of the erased key stay in place, so the finger remains valid for
+     * the next nearby operation.
+     */
+    template<typename K>
+    bool erase_at_finger(finger& hint, const K& key) {
+        if (empty()) {
+            return false;
+        }
+
+        update_path_type update_path;
+        SkipNode* current = finger_path(key, hint, update_path.data());
+        if (!current) {
+            return false; // Element not found
+        }
+
+        unlink_node(current, update_path.data());
+        hint.version_ = modification_count_;
+        return true;
+    }
+
+    /**
+     * @brief Unlinks and destroys a node found by a search.
+     * @param current The node to remove.
+     * @param update_path The tower of the last node before `current` on every level
+     *        below `current_height_`.
+     */
+    void unlink_node(SkipNode* current, tower_ptr* update_path) noexcept {
+        detach_node(current, update_path);
+        dispose_node(current);
+    }
+
+    /// @brief Unlinks a node found by a search without destroying it; see unlink_node().
+    void detach_node(SkipNode* current, tower_ptr* update_path) noexcept {
+        for (int i = 0; i < current_height_; ++i) {
+            if (update_path[i][i] == current) {
+                if constexpr (uses_spans) {
+                    spans_of(update_path[i])[i] += current->spans()[i] - 1;
+                }
+                store_link(update_path[i], i, current->forward()[i]);
+            } else if constexpr (uses_spans) {
+                --spans_of(update_path[i])[i];
+            } else {
+                break;
+            }
+        }
+        if constexpr (uses_backward) {
+            SkipNode* next = current->forward()[0];
+            (next ? next->backward : tail_) = current->backward;
+        }
+
+        trim_height();
+
+        --element_count_;
+        count_towers(current->height, -1);
+        ++modification_count_;
+    }
+
+    /**
+     * @brief Calls `visit(i)` for the batch positions `0 .. count - 1` in key order.
+     *
+     * Already sorted batches are visited in place; otherwise a stably sorted index
+     * permutation is built, so among equivalent keys the earliest one comes first.
+     * Probe types the comparator cannot order among themselves are visited as given.
+     * @param count The number of batch entries.
+     * @param key_at Returns the key of the entry at a position.
+     * @param visit Called once per position.
+     */
+    template<typename KeyAt, typename Visit>
+    void visit_sorted(std::size_t count, KeyAt key_at, Visit visit) {
+        using key_ref = std::invoke_result_t<KeyAt&, std::size_t>;
+        const auto visit_in_place = [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                visit(i);
+            }
+        };
+
+        if constexpr (!std::is_invocable_r_v<bool, const Compare&, key_ref, key_ref>) {
+            visit_in_place();
+        } else {
+            const auto less = [&](std::size_t a, std::size_t b) { return comp_(key_at(a), key_at(b)); };
+            std::size_t sorted_prefix = 1;
+            while (sorted_prefix < count && !less(sorted_prefix, sorted_prefix - 1)) {
+                ++sorted_prefix;
+            }
+            if (sorted_prefix >= count) {
+                visit_in_place();
+                return;
+            }
+
+            using index_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+            std::vector<std::size_t, index_allocator> order(count, index_allocator(pool_.get_allocator()));
+            for (std::size_t i = 0; i < count; ++i) {
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(), less);
+            for (std::size_t i : order) {
+                visit(i);
+            }
+        }
+    }
+
+    /// @brief Implements erase_batch() as one finger sweep over the sorted keys.
+    template<typename K>
+    size_type erase_sorted_batch(std::span<const K> keys, std::span<bool> erased) {
+        if (!erased.empty()) {
+            check_batch(keys.size(), erased.size(), "skip_list::erase_batch: results shorter than keys");
+        }
+        finger hint;
+        size_type count = 0;
+        visit_sorted(keys.size(), [&](std::size_t i) -> const K& { return keys[i]; }, [&](std::size_t i) {
+            const bool removed = erase_at_finger(hint, keys[i]);
+            if (!erased.empty()) {
+                erased[i] = removed;
+            }
+            count += removed;
+        });
+        return count;
+    }
+
+    /**
+     * @brief Descends from the sentinel head to the first node greater than a key.
+     *
+     * @param key The key to search for.
+     * @return The first node whose key is greater than `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* search_upper(const K& key) const {
+        count_search();
+        tower_ptr current = head_tower();
+        for (int i = load_height() - 1; i >= 0; --i) {
+            while (SkipNode* next = load_link(current, i)) {
+                count_comparison();
+                if (comp_(key, key_of(next->value))) break;
+                count_hop(i);
+                current = next->forward();
+            }
+        }
+        return load_link(current, 0);
+    }
+
+    /**
+     * @brief Finds the node equivalent to a key no smaller than the previous key of a sorted sweep.
+     *
+     * `path` holds the last node before the previous key on every level below `height`
+     * (`nullptr` for the head). The search climbs from it until the key is bracketed and
+     * then descends, like finger_search(), but reads only through load_link(), so a pinned
+     * reader may sweep beside the writer.
+     * @return The node equivalent to `key`, or `nullptr`.
+     */
+    template<typename K>
+    SkipNode* sweep_find(const K& key, std::array<SkipNode*, MAX_HEIGHT>& path, int height) const {
+        count_search();
+        int level = 0;
+        for (; level < height; ++level) {
+            SkipNode* next = load_link(tower_of(path[level]), level);
+            if (!next) break;
+            count_comparison();
+            if (!comp_(key_of(next->value), key)) break; // The key is bracketed.
+        }
+
+        SkipNode* node = level < height ? path[level] : nullptr;
+        tower_ptr current = tower_of(node);
+        for (int i = level - 1; i >= 0; --i) {
+            while (SkipNode* next = load_link(current, i)) {
+                count_comparison();
+                if (!comp_(key_of(next->value), key)) break;
+                count_hop(i);
+                node = next;
+                current = node->forward();
+            }
+            path[i] = node;
+        }
+        SkipNode* found = load_link(current, 0);
+        return matches(found, key) ? found : nullptr;
+    }
+
+    /**
+     * @brief Returns the element count batch_lookup() picks its strategy by.
+     *
+     * With concurrent readers the writer updates the count with plain stores, so it is
+     * estimated from the height instead, about `2^(PROMOTION_SHIFT * (height - 1))`.
+     */
+    size_type batch_sizing_count(int height) const noexcept {
+        if constexpr (uses_rcu) {
+            return height == 0 ? 0 : size_type{1} << std::min(PROMOTION_SHIFT * (height - 1), 62);
+        } else {
+            return element_count_;
+        }
+    }
+
+    static constexpr std::size_t batch_lanes = 8;          ///< The number of descents interleaved by batch_lookup().
+    static constexpr std::size_t batch_min_size = 1 << 17; ///< Smaller lists stay in cache; interleaving only adds branches.
+    static constexpr std::size_t sweep_max_gap = 64;       ///< The widest average gap between sorted probes worth a finger sweep.
+
+    /**
+     * @brief Looks up many keys at once, reporting each equivalent node (or `nullptr`).
+     *
+     * Sorted probes that are dense enough share a finger, so each lookup only climbs
+     * from the previous one. Otherwise, on lists too large for the cache, the probes run
+     * as `batch_lanes` interleaved descents: every step of one descent prefetches the
+     * node it compares against next, and the other lanes run while that load is in
+     * flight. The thresholds come from benchmarks/bench_batch_lookup.cpp. With
+     * Traits::concurrent_readers the whole batch runs in one read-side section and every
+     * link is read through load_link().
+     * @param keys The keys to look up.
+     * @param emit Called as `emit(index, node)` once per key, in no particular order.
+     */
+    template<typename K, typename Emit>
+    void batch_lookup(std::span<const K> keys, Emit emit) const {
+        [[maybe_unused]] const auto section = pin_reader();
+        const int height = load_height();
+        const size_type count = batch_sizing_count(height);
+        if constexpr (std::is_invocable_r_v<bool, const Compare&, const K&, const K&>) {
+            if (count <= keys.size() * sweep_max_gap && std::is_sorted(keys.begin(), keys.end(), comp_)) {
+                std::array<SkipNode*, MAX_HEIGHT> path{};
+                for (std::size_t i = 0; i < keys.size(); ++i) {
+                    emit(i, sweep_find(keys[i], path, height));
+                }
+                return;
+            }
+        }
+
+        if (count < batch_min_size || height == 0) {
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                emit(i, find_node(keys[i]));
+            }
+            return;
+        }
+
+        struct lane {
+            tower_ptr tower;
+            int level;
+            std::size_t index;
+        };
+        std::array<lane, batch_lanes> lanes;
+        std::size_t active = 0;
+        std::size_t next_key = 0;
+        while (active < batch_lanes && next_key < keys.size()) {
+            lane& l = lanes[active++];
+            l = {head_tower(), height - 1, next_key++};
+            count_search();
+            skip_list_detail::prefetch(load_link(l.tower, l.level));
+        }
+
+        while (active > 0) {
+            for (std::size_t j = 0; j < active;) {
+                lane& l = lanes[j];
+                const K& key = keys[l.index];
+                SkipNode* next = load_link(l.tower, l.level);
+                if (next) {
+                    count_comparison();
+                }
+                if (next && comp_(key_of(next->value), key)) {
+                    count_hop(l.level);
+                    l.tower = next->forward();
+                } else if (l.level > 0) {
+                    --l.level;
+                } else {
+                    emit(l.index, matches(next, key) ? next : nullptr);
+                    if (next_key == keys.size()) {
+                        l = lanes[--active];
+                        continue;
+                    }
+                    l = {head_tower(), height - 1, next_key++};
+                    count_search();
+                }
+                skip_list_detail::prefetch(load_link(l.tower, l.level));
+                ++j;
+            }
+        }
+    }
+
+    /// @brief Checks that a batch result span can hold one entry per key.
+    static void check_batch(std::size_t keys, std::size_t results, const char* what) {
+        if (results < keys) {
+            throw std::invalid_argument(what);
+        }
+    }
+
+    /// @brief Implements rank(): sums the spans skipped while descending to `key`.
+    template<typename K>
+    size_type rank_of(const K& key) const requires uses_spans {
+        size_type rank = 0;
+        tower_ptr current = head_tower();
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (current[i] && comp_(key_of(current[i]->value), key)) {
+                rank += spans_of(current)[i];
+                current = current[i]->forward();
+            }
+        }
+        return rank;
+    }
+
+    /// @brief Implements nth(): descends while the spans do not overshoot position `index + 1`.
+    SkipNode* node_at(size_type index) const noexcept requires uses_spans {
+        if (index >= element_count_) {
+            return nullptr;
+        }
+
+        const size_type target = index + 1;
+        size_type traversed = 0;
+        tower_ptr current = head_tower();
+        SkipNode* node = nullptr;
+        for (int i = current_height_ - 1; i >= 0 && traversed != target; --i) {
+            while (current[i] && traversed + spans_of(current)[i] <= target) {
+                traversed += spans_of(current)[i];
+                node = current[i];
+                current = node->forward();
+            }
+        }
+        return node;
+    }
+
+    /// @brief Implements advance(): climbs the towers met on the way and takes the longest
+    ///        hop that does not overshoot.
+    SkipNode* advance_node(SkipNode* node, size_type n) const noexcept requires uses_spans {
+        while (node && n > 0) {
+            int i = node->height - 1;
+            while (i > 0 && (!node->forward()[i] || node->spans()[i] > n)) {
+                --i;
+            }
+            n -= i > 0 ? node->spans()[i] : 1;
+            node = node->forward()[i];
+        }
+        return node;
+    }
+
+    /// @brief Implements equal_range() with the single descent of search().
+    template<typename K>
+    std::pair<SkipNode*, SkipNode*> equal_range_of(const K& key) const {
+        SkipNode* first = search(key);
+        return {first, matches(first, key) ? load_link(first->forward(), 0) : first};
+    }
+
+    /// @brief Implements erase_range() with one descent to `lo` and one unlinking pass.
+    template<typename K1, typename K2>
+    size_type erase_range_of(const K1& lo, const K2& hi) {
+        if (empty() || !comp_(lo, hi)) {
+            return 0;
+        }
+
+        update_path_type update_path;
+        update_path[0] = head_tower(); // Always overwritten, the list being non-empty; GCC cannot tell.
+        search(lo, update_path.data());
+        return erase_span(update_path.data(), [this, &hi](const SkipNode* node) {
+            return comp_(key_of(node->value), hi);
+        });
+    }
+
+    /**
+     * @brief Unlinks and destroys the run of nodes following an update path.
+     *
+     * Every node is skipped over on each level it spans by rewriting the towers of the
+     * update path, so the whole span costs one pass and no further searches.
+     * @param update_path The tower of the last node kept before the span on every level
+     *        below `current_height_`.
+     * @param in_span Called on each candidate node in order; the sweep stops at the first
+     *        node for which it returns `false`.
+     * @return The number of erased elements.
+     */
+    template<typename InSpan>
+    size_type erase_span(tower_ptr* update_path, InSpan in_span) {
+        size_type erased = 0;
+        SkipNode* current = update_path[0][0];
+        while (current && in_span(current)) {
+            SkipNode* next = current->forward()[0];
+            for (int i = 0; i < current->height; ++i) {
+                if constexpr (uses_spans) {
+                    spans_of(update_path[i])[i] += current->spans()[i];
+                }
+                store_link(update_path[i], i, current->forward()[i]);
+            }
+            count_towers(current->height, -1);
+            dispose_node(current);
+            current = next;
+            ++erased;
+        }
+        if constexpr (uses_spans) {
+            for (int i = 0; i < current_height_; ++i) {
+                spans_of(update_path[i])[i] -= erased;
+            }
+        }
+        if constexpr (uses_backward) {
+            (current ? current->backward : tail_) = node_of(update_path[0]);
+        }
+
+        trim_height();
+
+        element_count_ -= erased;
+        ++modification_count_;
+        return erased;
+    }
+
+public:
+    /**
+     * @brief Default constructor for FastList.
+     *
+     * Initializes an empty list. No memory is allocated until the first insertion.
+     */
+    basic_skip_list() : basic_skip_list(Compare(), Allocator()) {}
+
+    /**
+     * @brief Constructs an empty list that obtains its memory from the given allocator.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit basic_skip_list(const Allocator& alloc) : basic_skip_list(Compare(), alloc) {}
+
+    /**
+     * @brief Constructs an empty list ordered by the given comparator.
+     * @param comp The ordering applied to keys.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit basic_skip_list(const Compare& comp, const Allocator& alloc = Allocator())
+        : comp_(comp),
+          pool_(alloc),
+          sentinel_head_{},
+          current_height_(0),
+          element_count_(0),
+          domain_(&reclaim_node, this) {}
+
+    /**
+     * @brief Constructs an empty list whose tower heights are drawn from a seeded generator.
+     *
+     * Two lists built with the same seed and fed the same operations have identical shapes.
+     * @param seed The seed passed to the level generator.
+     * @param comp The ordering applied to keys.
+     * @param alloc The allocator to use for all node memory.
+     */
+    explicit basic_skip_list(std::uint64_t seed, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : comp_(comp),
+          pool_(alloc),
+          sentinel_head_{},
+          current_height_(0),
+          element_count_(0),
+          random_engine_(seed),
+          domain_(&reclaim_node, this) {}
+
+    /**
+     * @brief Constructs a list from the elements of a range.
+     *
+     * Sorted input is linked level by level in a single O(n) pass, see insert_sorted();
+     * unsorted input is still accepted and merely slower.
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     * @param comp The ordering applied to keys.
+     * @param alloc The allocator to use for all node memory.
+     */
+    template<std::input_iterator InputIt>
+    basic_skip_list(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : basic_skip_list(comp, alloc) {
+        insert_sorted(first, last);
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * The copy is linked in one O(n) pass and gets the same tower heights as `other`,
+     * see append_all(). The allocator is obtained through
+     * `select_on_container_copy_construction`.
+     * @param other The list to copy.
+     */
+    basic_skip_list(const basic_skip_list& other)
+        : basic_skip_list(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                                     other.get_allocator())) {}
+
+    /**
+     * @brief Copies a list into memory obtained from the given allocator.
+     * @param other The list to copy.
+     * @param alloc The allocator to use for all node memory.
+     */
+    basic_skip_list(const basic_skip_list& other, const Allocator& alloc) : basic_skip_list(other.comp_, alloc) {
+        random_engine_ = other.random_engine_;
+        append_all(other);
+    }
+
+    /**
+     * @brief Move constructor; takes over the nodes of `other` in O(1) and leaves it empty.
+     *
+     * With Traits::concurrent_readers no reader may be running on `other`.
+     * @param other The list to move from.
+     */
+    basic_skip_list(basic_skip_list&& other) noexcept : basic_skip_list(other.comp_, other.get_allocator()) {
+        swap_contents(other);
+    }
+
+    /**
+     * @brief Replaces the elements with a copy of those of `other`, see the copy constructor.
+     * @param other The list to copy.
+     * @return A reference to this list.
+     */
+    basic_skip_list& operator=(const basic_skip_list& other) {
+        if (this != &other) {
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (pool_.get_allocator() != other.pool_.get_allocator()) {
+                    reclaim_retired();
+                    pool_ = node_pool(other.get_allocator());
+                }
+            }
+            comp_ = other.comp_;
+            random_engine_ = other.random_engine_;
+            append_all(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the elements with those of `other`, leaving it empty.
+     *
+     * Takes over the nodes in O(1) when the allocator propagates or both allocators are
+     * equal; otherwise the elements are moved one by one into nodes of this list's allocator.
+     * With Traits::concurrent_readers no reader may be running on either list.
+     * @param other The list to move from.
+     * @return A reference to this list.
+     */
+    basic_skip_list& operator=(basic_skip_list&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+        if (this != &other) {
+            clear();
+            comp_ = other.comp_;
+            if (alloc_traits::propagate_on_container_move_assignment::value ||
+                pool_.get_allocator() == other.pool_.get_allocator()) {
+                swap_contents(other);
+            } else {
+                append_all(other);
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents of two lists in O(1).
+     *
+     * Allocators are exchanged as well, so they must either propagate on swap or compare
+     * equal, as for the standard containers. Fingers into either list become stale.
+     * With Traits::concurrent_readers no reader may be running on either list.
+     * @param other The list to exchange contents with.
+     */
+    void swap(basic_skip_list& other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+        using std::swap;
+        swap(comp_, other.comp_);
+        swap_contents(other);
+    }
+
+    /// @copydoc swap(basic_skip_list&)
+    friend void swap(basic_skip_list& a, basic_skip_list& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+    /**
+     * @brief Destructor for FastList.
+     *
+     * Deallocates all nodes and frees memory.
+     */
+    ~basic_skip_list() {
+        destroy_all_values();
+    }
+
+    /**
+     * @brief Returns a copy of the allocator associated with the list.
+     */
+    allocator_type get_allocator() const { return allocator_type(pool_.get_allocator()); }
+
+    /**
+     * @brief Returns the comparator that orders the keys.
+     */
+    key_compare key_comp() const { return comp_; }
+
+    /**
+     * @brief Writes a binary image of the list that skip_list_view serves lookups from in place.
+     *
+     * The image keeps every tower with its height; links are stored as byte offsets, so it
+     * can be mapped at any address (see skip_list_detail::image_header for the layout).
+     * The successor offsets are computed in one sweep from the back and buffered, 8 bytes
+     * per tower level plus 9 bytes per element, then the records are streamed out in 64 KiB
+     * chunks, prefetching the nodes ahead. O(n).
+     * @param write Called as `write(const char* data, std::size_t size)` with consecutive chunks of the image.
+     */
+    template<typename Writer>
+        requires std::is_trivially_copyable_v<value_type> && std::invocable<Writer&, const char*, std::size_t>
+    void save(Writer write) const {
+        using record = skip_list_detail::image_record<value_type>;
+        std::vector<const SkipNode*> nodes;
+        std::vector<std::uint8_t> heights;
+        nodes.reserve(element_count_);
+        heights.reserve(element_count_);
+        std::size_t link_count = 0;
+        for (SkipNode* node = load_link(head_tower(), 0); node; node = load_link(node->forward(), 0)) {
+            nodes.push_back(node);
+            heights.push_back(static_cast<std::uint8_t>(node->height));
+            link_count += static_cast<std::size_t>(node->height);
+        }
+        const std::size_t height = current_height_;
+
+        std::uint64_t end = record::first(height);
+        for (std::uint8_t h : heights) {
+            end += record::size(h);
+        }
+        const std::uint64_t bytes = end;
+        std::vector<std::uint64_t> links(link_count);
+        std::array<std::uint64_t, MAX_HEIGHT> next{}; // The first record behind the sweep on every level.
+        for (std::size_t i = heights.size(); i-- > 0;) {
+            end -= record::size(heights[i]);
+            link_count -= heights[i];
+            for (std::size_t level = 0; level < heights[i]; ++level) {
+                links[link_count + level] = next[level];
+                next[level] = end;
+            }
+        }
+
+        constexpr std::size_t chunk_bytes = 64 * 1024;
+        std::vector<char> chunk(chunk_bytes + std::max(record::first(MAX_HEIGHT), record::size(MAX_HEIGHT)));
+        std::size_t used = 0;
+        const auto flush = [&] {
+            write(static_cast<const char*>(chunk.data()), used);
+            used = 0;
+        };
+
+        skip_list_detail::image_header header{};
+        header.magic = skip_list_detail::image_header::signature;
+        header.version = skip_list_detail::image_header::current_version;
+        header.byte_order = skip_list_detail::image_header::native_byte_order;
+        header.value_size = sizeof(value_type);
+        header.value_align = alignof(value_type);
+        header.height = static_cast<std::uint32_t>(height);
+        header.count = element_count_;
+        header.bytes = bytes;
+        std::memcpy(chunk.data(), &header, sizeof(header));
+        std::memcpy(chunk.data() + sizeof(header), next.data(), 8 * height);
+        used = record::first(height);
+
+        constexpr std::size_t prefetch_distance = 8;
+        std::size_t link = 0;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            if (i + prefetch_distance < nodes.size()) {
+                skip_list_detail::prefetch(nodes[i + prefetch_distance]);
+            }
+            char* at = chunk.data() + used;
+            const std::size_t size = record::size(heights[i]);
+            std::memcpy(at, std::addressof(nodes[i]->value), sizeof(value_type));
+            std::memset(at + sizeof(value_type), 0, record::links_offset - sizeof(value_type));
+            for (std::size_t level = 0; level < heights[i]; ++level, ++link) {
+                std::memcpy(at + record::links_offset + 8 * level, &links[link], 8);
+            }
+            const std::size_t filled = record::links_offset + 8 * std::size_t{heights[i]};
+            std::memset(at + filled, 0, size - filled);
+            used += size;
+            if (used >= chunk_bytes) {
+                flush();
+            }
+        }
+        if (used > 0) {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Writes the image described at save(Writer) const to a stream opened in binary mode.
+     *
+     * Failures are reported through the stream state.
+     * @param out The stream to write to.
+     */
+    void save(std::ostream& out) const requires std::is_trivially_copyable_v<value_type> {
+        save([&out](const char* data, std::size_t size) { out.write(data, static_cast<std::streamsize>(size)); });
+    }
+
+    /**
+     * @brief Copies the elements into an immutable container laid out for lookups.
+     *
+     * The copy keeps the find(), contains(), lower_bound(), upper_bound() and iteration
+     * API but stores the elements in one array under a cache-friendly index, see
+     * basic_frozen_skip_list; include frozen_skip_list.hpp to call it. O(n).
+     */
+    basic_frozen_skip_list<Value, KeyOfValue, Compare, Allocator> freeze() const {
+        return basic_frozen_skip_list<Value, KeyOfValue, Compare, Allocator>(begin(), end(), comp_, get_allocator());
+    }
+
+    /**
+     * @brief Removes all elements from the list.
+     *
+     * After this operation, the list becomes empty. Node memory is returned to the
+     * allocator slab by slab rather than node by node. With Traits::concurrent_readers the
+     * nodes are retired instead and reused once the running readers are done with them.
+     */
+    void clear() {
+        if constexpr (uses_rcu) {
+            // Readers may still be walking the old nodes: unhook them all, then retire them one by one.
+            SkipNode* current = sentinel_head_[0];
+            for (int i = 0; i < MAX_HEIGHT; ++i) {
+                store_link(head_tower(), i, nullptr);
+            }
+            epoch_domain::guard guard = domain_.pin();
+            while (current) {
+                SkipNode* next = current->forward()[0];
+                guard.retire(current);
+                current = next;
+            }
+        } else {
+            destroy_all_values();
+            pool_.release();
+            sentinel_head_.fill(nullptr);
+        }
+
+        if constexpr (uses_backward) {
+            tail_ = nullptr;
+        }
+        store_height(0);
+        element_count_ = 0;
+        reset_tower_counts();
+        ++modification_count_;
+    }
+
+    /**
+     * @brief Inserts a new value into the list.
+     *
+     * If the value already exists, the insertion is aborted.
+     * @param value The value to be inserted.
+     * @return `true` if the insertion was successful, `false` if the value was already present.
+     */
+    bool insert(const value_type& value) {
+        return insert_unique(key_of(value), value).second;
+    }
+
+    /**
+     * @brief Inserts a new value into the list by moving it into the new node.
+     *
+     * If the value already exists, the insertion is aborted and `value` is left untouched.
+     * @param value The value to be inserted.
+     * @return `true` if the insertion was successful, `false` if the value was already present.
+     */
+    bool insert(value_type&& value) {
+        return insert_unique(key_of(value), std::move(value)).second;
+    }
+
+    /**
+     * @brief Constructs a value in place from `args` and inserts it.
+     *
+     * When `args` is a single `value_type`, the search runs before anything is constructed.
+     * Otherwise the node is constructed first (its key is needed for the search) and
+     * destroyed again if an equivalent key is already present; use emplace_hint() to
+     * avoid that construction.
+     * @param args The arguments the value is constructed from.
+     * @return An iterator to the element holding the key and whether it was inserted.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, value_type> && ...)) {
+            auto [node, inserted] = insert_unique(key_of(args)..., std::forward<Args>(args)...);
+            return {make_iterator(node), inserted};
+        } else {
+            auto [node, inserted] = insert_node(create_node(generateRandomHeight(), std::forward<Args>(args)...));
+            return {make_iterator(node), inserted};
+        }
+    }
+
+    /**
+     * @brief Constructs a value in place from `args` unless `key` is already present.
+     *
+     * `key` tells the list the key the constructed value will have, so the search runs
+     * first and nothing is constructed (and `args` are not moved from) for a duplicate.
+     * With a transparent comparator `key` may be of any type comparable with the keys.
+     * @param key A key equivalent to the key of the value built from `args`.
+     * @param args The arguments the value is constructed from.
+     * @return An iterator to the element holding the key and whether it was inserted.
+     */
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplace_hint(const K& key, Args&&... args) {
+        auto [node, inserted] = insert_unique(key, std::forward<Args>(args)...);
+        return {make_iterator(node), inserted};
+    }
+
+    /**
+     * @brief Inserts a new value, starting the search from a finger.
+     *
+     * Consecutive insertions of nearby keys through the same finger cost O(log d), d being
+     * the distance to the previously inserted key. The finger is left pointing at the
+     * inserted (or already present) key.
+     * @param hint The finger to search from.
+     * @param value The value to be inserted.
+     * @return `true` if the insertion was successful, `false` if the value was already present.
+     */
+    bool insert(finger& hint, const value_type& value) {
+        return insert_at_finger(hint, key_of(value), value).second;
+    }
+
+    /**
+     * @copydoc insert(finger&, const value_type&)
+     */
+    bool insert(finger& hint, value_type&& value) {
+        return insert_at_finger(hint, key_of(value), std::move(value)).second;
+    }
+
+    /**
+     * @brief Inserts a micro-batch of values in one forward sweep.
+     *
+     * The batch is visited in key order (an index permutation is sorted unless it is
+     * already sorted) and merged through one finger, so each insertion only climbs from
+     * the previous position instead of descending from the head. For a batch of m keys
+     * spread over n elements this costs O(m log(n / m)) rather than O(m log n).
+     * @param values The values to insert. Among equivalent values, the first one wins.
+     * @param inserted Optionally receives, at index `i`, whether `values[i]` was inserted.
+     * @return The number of inserted values.
+     * @throw std::invalid_argument If `inserted` is neither empty nor as long as `values`.
+     */
+    size_type insert_batch(std::span<const value_type> values, std::span<bool> inserted = {}) {
+        if (!inserted.empty()) {
+            check_batch(values.size(), inserted.size(), "skip_list::insert_batch: results shorter than values");
+        }
+        finger hint;
+        size_type count = 0;
+        visit_sorted(values.size(), [&](std::size_t i) -> const key_type& { return key_of(values[i]); },
+                     [&](std::size_t i) {
+                         const bool added = insert_at_finger(hint, key_of(values[i]), values[i]).second;
+                         if (!inserted.empty()) {
+                             inserted[i] = added;
+                         }
+                         count += added;
+                     });
+        return count;
+    }
+
+    /**
+     * @brief Inserts the elements of a range, linking sorted runs in O(1) per element.
+     *
+     * While the elements are strictly greater than the current last element, every new
+     * node is appended directly behind the last tower of each level it spans, without
+     * any search from the sentinel head. An element that breaks the order (or is not
+     * past the end of the list) falls back to a regular insertion, after which the pass
+     * resumes. Duplicates are skipped.
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     * @param heights How the tower heights of the new nodes are chosen.
+     * @return The number of elements actually inserted.
+     */
+    template<std::input_iterator InputIt>
+    size_type insert_sorted(InputIt first, InputIt last, tower_heights heights = tower_heights::random) {
+        update_path_type tail;
+        SkipNode* back = find_tail(tail.data());
+        bool tail_valid = true;
+        size_type inserted = 0;
+
+        for (; first != last; ++first) {
+            const int height = heights == tower_heights::balanced ? balanced_height(element_count_ + 1)
+                                                                  : generateRandomHeight();
+            SkipNode* newNode = create_node(height, *first);
+
+            if (!tail_valid) {
+                back = find_tail(tail.data());
+                tail_valid = true;
+            }
+
+            if (back && !comp_(key_of(back->value), key_of(newNode->value))) {
+                // Out of order: a regular insertion may change the last tower of some levels.
+                inserted += insert_node(newNode).second;
+                tail_valid = false;
+                continue;
+            }
+
+            append_node(newNode, tail.data());
+            back = newNode;
+            ++inserted;
+        }
+        return inserted;
+    }
+
+    /**
+     * @brief Removes a value from the list.
+     *
+     * @param key The key of the value to be removed.
+     * @return `true` if the value was found and removed, `false` otherwise.
+     */
+    bool erase(const key_type& key) {
+        return erase_key(key);
+    }
+
+    /**
+     * @brief Removes the value equivalent to a key of another type (transparent comparators only).
+     *
+     * @param key A value comparable with the stored keys.
+     * @return `true` if the value was found and removed, `false` otherwise.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool erase(const K& key) {
+        return erase_key(key);
+    }
+
+    /**
+     * @brief Removes a micro-batch of keys in one forward sweep, see insert_batch().
+     * @param keys The keys to remove.
+     * @param erased Optionally receives, at index `i`, whether `keys[i]` was removed.
+     * @return The number of removed elements.
+     * @throw std::invalid_argument If `erased` is neither empty nor as long as `keys`.
+     */
+    size_type erase_batch(std::span<const key_type> keys, std::span<bool> erased = {}) {
+        return erase_sorted_batch(keys, erased);
+    }
+
+    /**
+     * @copydoc erase_batch(std::span<const key_type>, std::span<bool>)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    size_type erase_batch(std::span<const K> keys, std::span<bool> erased = {}) {
+        return erase_sorted_batch(keys, erased);
+    }
+
+    /**
+     * @brief Searches for a value in the list.
+     *
+     * @param key The key to search for.
+     * @return `true` if the value is found, `false` otherwise.
+     */
+    bool contains(const key_type& key) const {
+        [[maybe_unused]] const auto section = pin_reader();
+        return find_node(key) != nullptr;
+    }
+
+    /**
+     * @brief Searches for a key of another type without building a temporary key
+     *        (transparent comparators only).
+     *
+     * @param key A value comparable with the stored keys.
+     * @return `true` if an equivalent key is found, `false` otherwise.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool contains(const K& key) const {
+        [[maybe_unused]] const auto section = pin_reader();
+        return find_node(key) != nullptr;
+    }
+
+    /**
+     * @brief Opens a read-side section (lists with Traits::concurrent_readers only).
+     *
+     * Nodes reached while the returned guard lives, through find(), lower_bound(),
+     * upper_bound(), equal_range() or iteration, stay valid even if the writer erases them
+     * meanwhile; contains() opens its own section. Sections nest and never block the
+     * writer, but a long one delays the reuse of erased nodes. The guard belongs to the
+     * calling thread.
+     */
+    epoch_domain::guard read_lock() const requires uses_rcu {
+        return domain_.pin();
+    }
+
+    /**
+     * @brief Checks many keys at once, hiding cache misses across independent lookups.
+     *
+     * Already sorted probes are answered with one finger sweep; otherwise several
+     * descents are interleaved with software prefetching. Sort the probes first when
+     * that is cheap for the caller: the sweep touches each node at most once. Like
+     * contains(), the batch opens its own read-side section with Traits::concurrent_readers.
+     * @param keys The keys to look up.
+     * @param results Receives `contains(keys[i])` at index `i`.
+     * @throw std::invalid_argument If `results` is shorter than `keys`.
+     */
+    void contains_batch(std::span<const key_type> keys, std::span<bool> results) const {
+        check_batch(keys.size(), results.size(), "skip_list::contains_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = node != nullptr; });
+    }
+
+    /**
+     * @copydoc contains_batch(std::span<const key_type>, std::span<bool>) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    void contains_batch(std::span<const K> keys, std::span<bool> results) const {
+        check_batch(keys.size(), results.size(), "skip_list::contains_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = node != nullptr; });
+    }
+    
+    /**
+     * @class basic_iterator
+     * @brief The iterator for the FastList, in a mutable and a constant flavour.
+     *
+     * It models `std::forward_iterator` (`std::bidirectional_iterator` with backward links),
+     * so the list composes with `std::ranges` algorithms and views as it is. It also compares
+     * equal to `std::default_sentinel` at the end of the list.
+     * @tparam IsConst Whether the iterator only gives read access to the elements.
+     */
+    template<bool IsConst>
+    class basic_iterator {
+        friend class basic_skip_list;
+        template<bool> friend class basic_iterator;
+
+        SkipNode* current_node_;
+        /// The list, needed to step back from `end()`; bidirectional lists only.
+        [[no_unique_address]] std::conditional_t<uses_backward, const basic_skip_list*, skip_list_detail::no_link> owner_;
+
+    public:
+        using iterator_category = std::conditional_t<uses_backward, std::bidirectional_iterator_tag,
+                                                     std::forward_iterator_tag>;
+        using iterator_concept  = iterator_category;
+        using value_type        = std::remove_cv_t<Value>;
+        using reference         = std::conditional_t<IsConst, const Value&, Value&>;
+        using pointer           = std::conditional_t<IsConst, const Value*, Value*>;
+        using difference_type   = std::ptrdiff_t;
+
+        /**
+         * @brief Constructs an iterator.
+         * @param node A pointer to the node the iterator should point to.
+         * @param owner The list the node belongs to.
+         */
+        explicit basic_iterator(SkipNode* node = nullptr, const basic_skip_list* owner = nullptr) : current_node_(node) {
+            if constexpr (uses_backward) {
+                owner_ = owner;
+            } else {
+                static_cast<void>(owner);
+            }
+        }
+
+        /// @brief Converts a mutable iterator into a constant one.
+        template<bool ToConst = IsConst, typename = std::enable_if_t<ToConst>>
+        basic_iterator(const basic_iterator<false>& other) : current_node_(other.current_node_), owner_(other.owner_) {}
+
+        /// @brief Dereferences the iterator to access the node's value.
+        reference operator*() const { return current_node_->value; }
+
+        /// @brief Accesses a member of the node's value.
+        pointer operator->() const { return &current_node_->value; }
+
+        /// @brief Advances the iterator to the next node (prefix).
+        basic_iterator& operator++() {
+            if (current_node_) current_node_ = load_link(current_node_->forward(), 0);
+            return *this;
+        }
+
+        /// @brief Advances the iterator to the next node (postfix).
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// @brief Moves the iterator to the previous node; from `end()`, to the last one (prefix).
+        basic_iterator& operator--() requires uses_backward {
+            current_node_ = current_node_ ? current_node_->backward : owner_->tail_;
+            return *this;
+        }
+
+        /// @brief Moves the iterator to the previous node (postfix).
+        basic_iterator operator--(int) requires uses_backward {
+            basic_iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        /// @brief Compares two iterators, mutable or constant, for equality.
+        template<bool OtherConst>
+        bool operator==(const basic_iterator<OtherConst>& other) const noexcept {
+            return current_node_ == other.current_node_;
+        }
+
+        /// @brief Checks whether the iterator has reached the end of the list.
+        bool operator==(std::default_sentinel_t) const noexcept { return current_node_ == nullptr; }
+    };
+
+    /**
+     * @brief Finds an element with a specific value.
+     * @param key The key to find.
+     * @return An iterator to the found element, or `end()` if the element is not found.
+     */
+    iterator find(const key_type& key) { return make_iterator(find_node(key)); }
+
+    /// @copydoc find(const key_type&)
+    const_iterator find(const key_type& key) const { return make_iterator(find_node(key)); }
+
+    /**
+     * @brief Finds an element by a key of another type without building a temporary key
+     *        (transparent comparators only).
+     * @param key A value comparable with the stored keys.
+     * @return An iterator to the found element, or `end()` if the element is not found.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    iterator find(const K& key) { return make_iterator(find_node(key)); }
+
+    /// @copydoc find(const K&)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(const K& key) const { return make_iterator(find_node(key)); }
 
-private:
     /**
-     * @struct SkipNode
-     * @brief Represents a node within the FastList.
+     * @brief Finds an element, starting the search from a finger.
      *
-     * Each node stores a value and an array of pointers to subsequent nodes at different levels,
-     * enabling the skip-ahead functionality of the list.
+     * Lookups clustered around the previous one through the same finger cost O(log d).
+     * @param hint The finger to search from; receives the path to `key`.
+     * @param key The key to find.
+     * @return An iterator to the found element, or `end()` if the element is not found.
      */
-    struct SkipNode {
-        KeyType value; ///< The data payload of the node.
-        std::vector<SkipNode*> forward; ///< An array of forward pointers for each level.
+    iterator find(finger& hint, const key_type& key) { return make_iterator(finger_find(key, hint)); }
 
-        /**
-         * @brief Constructs a new SkipNode.
-         * @param level The number of forward pointers (height of the node).
-         * @param val The value to be stored in this node.
-         */
-        SkipNode(int level, const KeyType& val) : value(val), forward(level, nullptr) {}
-    };
+    /// @copydoc find(finger&, const key_type&)
+    const_iterator find(finger& hint, const key_type& key) const { return make_iterator(finger_find(key, hint)); }
 
-    static constexpr int MAX_HEIGHT = 16; ///< Defines the maximum possible height for any node.
-    const float promotion_probability_ = 0.5f; ///< The probability used to determine a new node's height.
+    /**
+     * @copydoc find(finger&, const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    iterator find(finger& hint, const K& key) { return make_iterator(finger_find(key, hint)); }
 
-    SkipNode* sentinel_head_; ///< A sentinel node that marks the beginning of the list.
-    int current_height_;      ///< The current maximum height among all nodes in the list.
-    size_t element_count_;    ///< The total number of elements currently in the list.
-    
-    std::mt19937 random_engine_; ///< Mersenne Twister engine for random number generation.
-    std::uniform_real_distribution<float> distribution_; ///< Uniform distribution for probability checks.
+    /// @copydoc find(finger&, const K&)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(finger& hint, const K& key) const { return make_iterator(finger_find(key, hint)); }
 
     /**
-     * @brief Determines a random height for a new node.
+     * @brief Finds many keys at once, see contains_batch().
      *
-     * The height is generated probabilistically. It starts at 1 and increases
-     * with a fixed probability until it reaches the maximum allowed height.
-     * @return A randomly generated height between 1 and MAX_HEIGHT.
+     * With Traits::concurrent_readers, as with find(), the iterators stay valid only
+     * inside a read_lock() section that spans their use.
+     * @param keys The keys to look up.
+     * @param results Receives `find(keys[i])` at index `i`.
+     * @throw std::invalid_argument If `results` is shorter than `keys`.
      */
-    int generateRandomHeight() {
-        int height = 1;
-        while (distribution_(random_engine_) < promotion_probability_ && height < MAX_HEIGHT) {
-            ++height;
-        }
-        return height;
+    void find_batch(std::span<const key_type> keys, std::span<iterator> results) {
+        check_batch(keys.size(), results.size(), "skip_list::find_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = make_iterator(node); });
+    }
+
+    /// @copydoc find_batch(std::span<const key_type>, std::span<iterator>)
+    void find_batch(std::span<const key_type> keys, std::span<const_iterator> results) const {
+        check_batch(keys.size(), results.size(), "skip_list::find_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = make_iterator(node); });
     }
 
-public:
     /**
-     * @brief Default constructor for FastList.
-     *
-     * Initializes an empty list with a sentinel head node.
+     * @copydoc find_batch(std::span<const key_type>, std::span<iterator>)
+     * @note Participates only with a transparent comparator.
      */
-    skip_list()
-        : sentinel_head_(new SkipNode(MAX_HEIGHT, KeyType{})), 
-          current_height_(0), 
-          element_count_(0),
-          random_engine_(std::random_device{}()), 
-          distribution_(0.0f, 1.0f) {}
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    void find_batch(std::span<const K> keys, std::span<iterator> results) {
+        check_batch(keys.size(), results.size(), "skip_list::find_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = make_iterator(node); });
+    }
+
+    /// @copydoc find_batch(std::span<const K>, std::span<iterator>)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    void find_batch(std::span<const K> keys, std::span<const_iterator> results) const {
+        check_batch(keys.size(), results.size(), "skip_list::find_batch: results shorter than keys");
+        batch_lookup(keys, [&](std::size_t i, SkipNode* node) { results[i] = make_iterator(node); });
+    }
 
     /**
-     * @brief Destructor for FastList.
+     * @brief Returns an iterator to the first element not less than a key.
+     * @param key The key to compare the elements to.
+     * @return An iterator to the first element whose key is not less than `key`, or `end()`.
+     */
+    iterator lower_bound(const key_type& key) { return make_iterator(search(key)); }
+
+    /// @copydoc lower_bound(const key_type&)
+    const_iterator lower_bound(const key_type& key) const { return make_iterator(search(key)); }
+
+    /**
+     * @copydoc lower_bound(const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    iterator lower_bound(const K& key) { return make_iterator(search(key)); }
+
+    /// @copydoc lower_bound(const K&)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator lower_bound(const K& key) const { return make_iterator(search(key)); }
+
+    /**
+     * @brief Returns an iterator to the first element greater than a key.
+     * @param key The key to compare the elements to.
+     * @return An iterator to the first element whose key is greater than `key`, or `end()`.
+     */
+    iterator upper_bound(const key_type& key) { return make_iterator(search_upper(key)); }
+
+    /// @copydoc upper_bound(const key_type&)
+    const_iterator upper_bound(const key_type& key) const { return make_iterator(search_upper(key)); }
+
+    /**
+     * @copydoc upper_bound(const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    iterator upper_bound(const K& key) { return make_iterator(search_upper(key)); }
+
+    /// @copydoc upper_bound(const K&)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator upper_bound(const K& key) const { return make_iterator(search_upper(key)); }
+
+    /**
+     * @brief Returns the range of elements equivalent to a key.
      *
-     * Deallocates all nodes and frees memory.
+     * Keys are unique, so the range holds at most one element; it costs a single descent.
+     * @param key The key to compare the elements to.
+     * @return The pair `lower_bound(key), upper_bound(key)`.
      */
-    ~skip_list() {
-        clear();
-        delete sentinel_head_;
+    std::pair<iterator, iterator> equal_range(const key_type& key) {
+        auto [first, last] = equal_range_of(key);
+        return {make_iterator(first), make_iterator(last)};
+    }
+
+    /// @copydoc equal_range(const key_type&)
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        auto [first, last] = equal_range_of(key);
+        return {make_iterator(first), make_iterator(last)};
     }
 
     /**
-     * @brief Removes all elements from the list.
+     * @copydoc equal_range(const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    std::pair<iterator, iterator> equal_range(const K& key) {
+        auto [first, last] = equal_range_of(key);
+        return {make_iterator(first), make_iterator(last)};
+    }
+
+    /// @copydoc equal_range(const K&)
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+        auto [first, last] = equal_range_of(key);
+        return {make_iterator(first), make_iterator(last)};
+    }
+
+    /**
+     * @brief Removes the elements in the range `[first, last)`.
      *
-     * After this operation, the list becomes empty.
+     * One descent to `first` records the update path; the span is then unlinked in a
+     * single pass without searching for each element.
+     * @param first The first element to remove.
+     * @param last The element following the last one to remove.
+     * @return `last`.
      */
-    void clear() {
-        SkipNode* current = sentinel_head_->forward[0];
-        while (current) {
-            SkipNode* next = current->forward[0];
-            delete current;
-            current = next;
+    iterator erase(const_iterator first, const_iterator last) {
+        SkipNode* stop = last.current_node_;
+        if (first == last) {
+            return make_iterator(stop);
         }
 
-        std::fill(sentinel_head_->forward.begin(), sentinel_head_->forward.end(), nullptr);
-        current_height_ = 0;
-        element_count_ = 0;
+        update_path_type update_path;
+        search(key_of(first.current_node_->value), update_path.data());
+        erase_span(update_path.data(), [stop](const SkipNode* node) { return node != stop; });
+        return make_iterator(stop);
     }
 
     /**
-     * @brief Inserts a new value into the list.
+     * @brief Removes every element whose key lies in the half-open interval `[lo, hi)`.
      *
-     * If the value already exists, the insertion is aborted.
-     * @param value The value to be inserted.
-     * @return `true` if the insertion was successful, `false` if the value was already present.
+     * One descent to `lo` records the update path; the span is then unlinked in a
+     * single pass without searching for each element.
+     * @param lo The smallest key to remove.
+     * @param hi The first key past the removed span.
+     * @return The number of erased elements.
      */
-    bool insert(const KeyType& value) {
-        std::vector<SkipNode*> update_path(MAX_HEIGHT, nullptr);
-        SkipNode* current = sentinel_head_;
-
-        for (int i = current_height_ - 1; i >= 0; --i) {
-            while (current->forward[i] && current->forward[i]->value < value) {
-                current = current->forward[i];
-            }
-            update_path[i] = current;
-        }
+    size_type erase_range(const key_type& lo, const key_type& hi) { return erase_range_of(lo, hi); }
 
-        current = current->forward[0];
+    /**
+     * @copydoc erase_range(const key_type&, const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K1, typename K2, typename C = Compare, typename = typename C::is_transparent>
+    size_type erase_range(const K1& lo, const K2& hi) { return erase_range_of(lo, hi); }
 
-        if (current && current->value == value) {
-            return false; // Element already exists
+    /**
+     * @brief Moves every element of `source` whose key is not present yet into this list.
+     *
+     * The elements equivalent to one of this list stay in `source`, as with `std::set::merge`.
+     * With equal allocators the nodes themselves are relinked: this list takes over the
+     * slabs of `source`, so nothing is allocated or moved except the duplicates, which are
+     * moved into new nodes of `source`. While node handles extracted from `source` are
+     * outstanding, the slabs are shared instead (see skip_list_node_pool::share()), so the
+     * handles stay valid. Otherwise the merged elements are moved into new
+     * nodes of this list. The keys of `source` are located from a finger that only moves
+     * forward, so merging m elements into n costs O(m log(n/m) + m).
+     *
+     * With Traits::concurrent_readers readers may keep running on this list, but not on `source`.
+     * @param source The list to take the elements from.
+     * @throw Whatever allocating a node or moving an element throws. Every element is then
+     *        in one of the two lists, except that with equal allocators the duplicates not
+     *        moved yet are destroyed.
+     */
+    void merge(basic_skip_list& source) {
+        if (&source == this || source.empty()) {
+            return;
         }
-
-        int newHeight = generateRandomHeight();
-        if (newHeight > current_height_) {
-            for (int i = current_height_; i < newHeight; ++i) {
-                update_path[i] = sentinel_head_;
+        source.reclaim_retired();
+        const bool adopt = pool_.get_allocator() == source.pool_.get_allocator();
+        if (adopt) {
+            if (source.extracted_nodes_ == 0) {
+                pool_.splice(source.pool_);
+            } else {
+                pool_.share(source.pool_); // The handles still free their nodes into `source`.
             }
-            current_height_ = newHeight;
         }
+        basic_skip_list& owner = adopt ? *this : source; // The list whose pool holds the pending nodes.
+        SkipNode* pending = source.detach_all();
 
-        SkipNode* newNode = new SkipNode(newHeight, value);
-        for (int i = 0; i < newHeight; ++i) {
-            newNode->forward[i] = update_path[i]->forward[i];
-            update_path[i]->forward[i] = newNode;
-        }
+        finger hint;
+        update_path_type kept; // The last tower on every level of `source`.
+        update_path_type update_path;
+        while (SkipNode* node = pending) {
+            const bool duplicate = finger_path(key_of(node->value), hint, update_path.data()) != nullptr;
+            basic_skip_list& target = duplicate ? source : *this;
+            if (&target != &owner) {
+                SkipNode* moved;
+                try {
+                    moved = target.create_node(node->height, std::move_if_noexcept(node->value));
+                } catch (...) {
+                    // `node` is intact. Give back what can be, then report the failure.
+                    for (SkipNode* rest = pending; rest; rest = pending) {
+                        pending = rest->forward()[0];
+                        if (!adopt) {
+                            source.append_node(rest, kept.data());
+                        } else if (finger_path(key_of(rest->value), hint, update_path.data())) {
+                            destroy_node(rest);
+                        } else {
+                            link_node(rest, update_path.data());
+                            advance_finger(hint, rest);
+                        }
+                    }
+                    throw;
+                }
+                pending = node->forward()[0];
+                owner.destroy_node(node);
+                node = moved;
+            } else {
+                pending = node->forward()[0];
+            }
 
-        ++element_count_;
-        return true;
+            if (duplicate) {
+                source.append_node(node, kept.data());
+            } else {
+                link_node(node, update_path.data());
+                advance_finger(hint, node);
+            }
+        }
     }
 
     /**
-     * @brief Removes a value from the list.
+     * @brief Appends the elements of a list whose keys all follow those of this list.
      *
-     * @param value The value to be removed.
-     * @return `true` if the value was found and removed, `false` otherwise.
+     * The first tower of every level of `other` is hooked behind the last tower of that
+     * level here, found by one walk down the right edge, and this list takes over the slabs
+     * of `other` (see skip_list_node_pool::splice()): no element is moved and the pointer
+     * work is O(log n). While node handles extracted from `other` are outstanding, the slabs
+     * are shared instead, so the handles stay valid. With unequal allocators the elements are moved over one by one instead.
+     *
+     * With Traits::concurrent_readers readers may keep running on this list, but not on `other`.
+     * @param other The list to append; left empty.
+     * @throw std::invalid_argument If the smallest key of `other` does not follow the largest key here.
      */
-    bool erase(const KeyType& value) {
-        if (empty()) {
-            return false;
+    void concat(basic_skip_list&& other) {
+        if (&other == this || other.empty()) {
+            return;
         }
 
-        std::vector<SkipNode*> update_path(MAX_HEIGHT, nullptr);
-        SkipNode* current = sentinel_head_;
-
+        update_path_type tail;
+        [[maybe_unused]] std::array<size_type, MAX_HEIGHT> positions; // Ranks of the tail towers, indexed lists only.
+        tower_ptr current = head_tower();
+        SkipNode* last = nullptr;
+        size_type position = 0;
         for (int i = current_height_ - 1; i >= 0; --i) {
-            while (current->forward[i] && current->forward[i]->value < value) {
-                current = current->forward[i];
+            while (current[i]) {
+                if constexpr (uses_spans) {
+                    position += spans_of(current)[i];
+                }
+                last = current[i];
+                current = last->forward();
+            }
+            tail[i] = current;
+            if constexpr (uses_spans) {
+                positions[i] = position;
             }
-            update_path[i] = current;
+        }
+        SkipNode* first = other.sentinel_head_[0];
+        if (last && !comp_(key_of(last->value), key_of(first->value))) {
+            throw std::invalid_argument("skip_list::concat: the lists' key ranges overlap");
         }
 
-        current = current->forward[0];
-
-        if (!current || current->value != value) {
-            return false; // Element not found
+        other.reclaim_retired();
+        if (pool_.get_allocator() != other.pool_.get_allocator()) {
+            SkipNode* node = first;
+            try {
+                for (; node; node = node->forward()[0]) {
+                    append_node(create_node(node->height, std::move_if_noexcept(node->value)), tail.data());
+                }
+            } catch (...) {
+                other.erase(other.begin(), other.make_iterator(node)); // Drop what was already moved.
+                throw;
+            }
+            other.clear();
+            return;
+        }
+        if (other.extracted_nodes_ == 0) {
+            pool_.splice(other.pool_);
+        } else {
+            pool_.share(other.pool_); // The handles still free their nodes into `other`.
         }
 
-        for (int i = 0; i < current_height_; ++i) {
-            if (update_path[i]->forward[i] != current) break;
-            update_path[i]->forward[i] = current->forward[i];
+        for (int i = current_height_; i < other.current_height_; ++i) {
+            tail[i] = head_tower();
+            if constexpr (uses_spans) {
+                positions[i] = 0;
+            }
+        }
+        for (int i = 0; i < other.current_height_; ++i) {
+            if constexpr (uses_spans) {
+                spans_of(tail[i])[i] = element_count_ - positions[i] + other.head_spans_[i];
+            }
+            store_link(tail[i], i, other.sentinel_head_[i]);
+        }
+        if constexpr (uses_backward) {
+            first->backward = last;
+            tail_ = other.tail_;
         }
+        if (other.current_height_ > current_height_) {
+            store_height(other.current_height_);
+        }
+        element_count_ += other.element_count_;
+        store_count(tower_links_, tower_links_ + other.tower_links_);
+        if constexpr (uses_level_counts) {
+            for (int h = 0; h < MAX_HEIGHT; ++h) {
+                store_count(height_counts_[h], height_counts_[h] + other.height_counts_[h]);
+            }
+        }
+        ++modification_count_;
+        other.detach_all();
+    }
 
-        delete current;
+    /**
+     * @brief Unlinks the element equivalent to a key and hands it over in a node handle.
+     *
+     * Not available with Traits::concurrent_readers, where readers may still be on the node.
+     * @param key The key of the element.
+     * @return A handle holding the element, or an empty handle if the key is not present.
+     */
+    node_type extract(const key_type& key) requires (!uses_rcu) { return extract_key(key); }
 
-        while (current_height_ > 0 && sentinel_head_->forward[current_height_ - 1] == nullptr) {
-            --current_height_;
-        }
+    /**
+     * @copydoc extract(const key_type&)
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    node_type extract(const K& key) requires (!uses_rcu) { return extract_key(key); }
 
-        --element_count_;
-        return true;
+    /**
+     * @brief Unlinks the element at an iterator and hands it over in a node handle.
+     * @param position An iterator to an element of this list.
+     * @return A handle holding the element.
+     */
+    node_type extract(const_iterator position) requires (!uses_rcu) {
+        return extract_key(key_of(position.current_node_->value));
     }
 
     /**
-     * @brief Searches for a value in the list.
+     * @brief Links the node held by a handle unless its key is already present.
      *
-     * @param value The value to search for.
-     * @return `true` if the value is found, `false` otherwise.
+     * A node extracted from this list is relinked with its tower height and nothing is
+     * allocated; the element of a node from another list is moved into a new node.
+     * @param handle The handle to insert; left empty on success.
+     * @return The position of the element with the node's key, whether the node was
+     *         inserted, and the handle given back when it was not.
      */
-    bool contains(const KeyType& value) const {
-        SkipNode* current = sentinel_head_;
-        for (int i = current_height_ - 1; i >= 0; --i) {
-            while (current->forward[i] && current->forward[i]->value < value) {
-                current = current->forward[i];
-            }
+    insert_return_type insert(node_type&& handle) {
+        if (handle.empty()) {
+            return {end(), false, node_type()};
+        }
+
+        update_path_type update_path;
+        if (SkipNode* existing = path_to(key_of(handle.node_->value), update_path.data())) {
+            return {make_iterator(existing), false, std::move(handle)};
         }
-        current = current->forward[0];
-        return current && current->value == value;
+
+        SkipNode* node = handle.node_;
+        if (handle.owner_ == this) {
+            handle.node_ = nullptr;
+            --extracted_nodes_;
+        } else {
+            node = create_node(node->height, std::move_if_noexcept(node->value));
+            handle.reset();
+        }
+        link_position(node, update_path.data());
+        return {make_iterator(node), true, node_type()};
     }
-    
+
     /**
-     * @class iterator
-     * @brief A forward iterator for the FastList.
+     * @brief Returns a list holding the elements of both lists; of two equivalent elements,
+     *        the one of `a` is kept.
      *
-     * This iterator allows traversal of the list in one direction.
+     * The smaller list drives a single pass: each of its keys is located in the larger one
+     * from a forward-moving finger, which gallops over long runs through the upper levels,
+     * and the run skipped over is copied without comparing keys. For sizes m <= n this costs
+     * O(m log(n/m) + m) comparisons and n + m node copies, which keep their tower heights.
+     * @param a The first list; its comparator and allocator are used for the result.
+     * @param b The second list.
      */
-    class iterator {
-        SkipNode* current_node_;
-
-    public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type        = KeyType;
-        using reference         = KeyType&;
-        using pointer           = KeyType*;
-        using difference_type   = std::ptrdiff_t;
+    template<std::derived_from<basic_skip_list> List>
+    friend List set_union(const List& a, const List& b) {
+        List result(a.key_comp(), a.get_allocator());
+        static_cast<basic_skip_list&>(result).assign_union(a, b);
+        return result;
+    }
 
-        /**
-         * @brief Constructs an iterator.
-         * @param node A pointer to the node the iterator should point to.
-         */
-        explicit iterator(SkipNode* node = nullptr) : current_node_(node) {}
+    /**
+     * @brief Returns a list holding the elements of `a` whose key is also in `b`.
+     *
+     * Only the keys of the smaller list are located in the other one, from a forward-moving
+     * finger, so this costs O(m log(n/m) + m) comparisons for sizes m <= n.
+     * @param a The first list; its comparator and allocator are used for the result.
+     * @param b The second list.
+     */
+    template<std::derived_from<basic_skip_list> List>
+    friend List set_intersection(const List& a, const List& b) {
+        List result(a.key_comp(), a.get_allocator());
+        static_cast<basic_skip_list&>(result).assign_intersection(a, b);
+        return result;
+    }
 
-        /// @brief Dereferences the iterator to access the node's value.
-        reference operator*() const { return current_node_->value; }
+    /**
+     * @brief Returns a list holding the elements of `a` whose key is not in `b`.
+     *
+     * The smaller list drives the pass as in set_union(), so a small `b` costs
+     * O(m log(n/m) + m) comparisons plus the copies, and a small `a` as many lookups.
+     * @param a The list to take the elements from; its comparator and allocator are used for the result.
+     * @param b The list of keys to leave out.
+     */
+    template<std::derived_from<basic_skip_list> List>
+    friend List set_difference(const List& a, const List& b) {
+        List result(a.key_comp(), a.get_allocator());
+        static_cast<basic_skip_list&>(result).assign_difference(a, b);
+        return result;
+    }
 
-        /// @brief Accesses a member of the node's value.
-        pointer operator->() const { return &current_node_->value; }
+    /**
+     * @brief Returns the number of elements whose key is less than `key` (indexed lists only).
+     *
+     * For a present key this is its 0-based position. Costs one descent.
+     * @param key The key to rank.
+     */
+    size_type rank(const key_type& key) const requires uses_spans { return rank_of(key); }
 
-        /// @brief Advances the iterator to the next node (prefix).
-        iterator& operator++() {
-            if (current_node_) current_node_ = current_node_->forward[0];
-            return *this;
-        }
+    /**
+     * @copydoc rank(const key_type&) const
+     * @note Participates only with a transparent comparator.
+     */
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    size_type rank(const K& key) const requires uses_spans { return rank_of(key); }
 
-        /// @brief Advances the iterator to the next node (postfix).
-        iterator operator++(int) {
-            iterator temp = *this;
-            ++(*this);
-            return temp;
-        }
+    /**
+     * @brief Returns an iterator to the element at a 0-based position (indexed lists only).
+     *
+     * Costs one descent, so percentiles of a live set are O(log n).
+     * @param index The position of the element.
+     * @return An iterator to the element, or `end()` if `index >= size()`.
+     */
+    iterator nth(size_type index) requires uses_spans { return make_iterator(node_at(index)); }
 
-        /// @brief Compares two iterators for equality.
-        friend bool operator==(const iterator& a, const iterator& b) { return a.current_node_ == b.current_node_; }
-        
-        /// @brief Compares two iterators for inequality.
-        friend bool operator!=(const iterator& a, const iterator& b) { return a.current_node_ != b.current_node_; }
-    };
+    /// @copydoc nth(size_type)
+    const_iterator nth(size_type index) const requires uses_spans { return make_iterator(node_at(index)); }
 
     /**
-     * @brief Finds an element with a specific value.
-     * * @param value The value to find.
-     * @return An iterator to the found element, or `end()` if the element is not found.
+     * @brief Returns the element at a 0-based position (indexed lists only).
+     * @param index The position of the element.
+     * @throw std::out_of_range If `index >= size()`.
      */
-    iterator find(const KeyType& value) const {
-        SkipNode* current = sentinel_head_;
-        for (int i = current_height_ - 1; i >= 0; --i) {
-            while (current->forward[i] && current->forward[i]->value < value) {
-                current = current->forward[i];
-            }
-        }
-        current = current->forward[0];
-        if (current && current->value == value) {
-            return iterator(current);
+    const value_type& at(size_type index) const requires uses_spans {
+        SkipNode* node = node_at(index);
+        if (!node) {
+            throw std::out_of_range("skip_list::at: index out of range");
         }
-        return end();
+        return node->value;
+    }
+
+    /**
+     * @brief Returns an iterator `n` elements past `it` in O(log n) (indexed lists only).
+     *
+     * The walk climbs the towers met on the way and takes the longest hop that does not
+     * overshoot, instead of stepping through every element.
+     * @param it The starting position.
+     * @param n The number of elements to skip.
+     * @return The advanced iterator, or `end()` if fewer than `n` elements follow `it`.
+     */
+    iterator advance(const_iterator it, size_type n) requires uses_spans {
+        return make_iterator(advance_node(it.current_node_, n));
+    }
+
+    /// @copydoc advance(const_iterator, size_type)
+    const_iterator advance(const_iterator it, size_type n) const requires uses_spans {
+        return make_iterator(advance_node(it.current_node_, n));
     }
 
     /**
@@ -298,15 +3396,224 @@ public:
      */
     bool empty() const { return element_count_ == 0; }
 
+    /**
+     * @brief Returns the number of levels in use: the height of the tallest tower, 0 when empty.
+     */
+    int height() const noexcept { return load_height(); }
+
+    /**
+     * @brief Returns the number of elements of every tower height.
+     *
+     * Entry `h - 1` counts the towers of height `h`. With Traits::level_counts the counts
+     * are kept up to date by every insertion and erasure, so this only copies
+     * `Traits::max_height` counters. Otherwise it is a diagnostic that walks the levels,
+     * see count_heights(). Either way it may run beside the writer with concurrent readers.
+     */
+    height_counts_type level_histogram() const noexcept {
+        if constexpr (uses_level_counts) {
+            height_counts_type counts;
+            for (int h = 0; h < MAX_HEIGHT; ++h) {
+                counts[h] = load_count(height_counts_[h]);
+            }
+            return counts;
+        } else {
+            return count_heights();
+        }
+    }
+
+    /**
+     * @brief Reports the memory held by the list, see skip_list_memory_usage.
+     *
+     * Computed from the element count, the number of forward pointers, which every
+     * insertion and erasure keeps up to date, and the slab sizes of the pool, in O(1) per
+     * pool arena: cheap enough to export as a metric. Like size(), it reads the writer's
+     * state, so with concurrent readers it belongs on the writer thread.
+     * Slabs still shared with another list after split_at() are counted by both.
+     */
+    skip_list_memory_usage memory_usage() const noexcept {
+        constexpr std::size_t per_level = node_size(1) - node_size(0);
+        skip_list_memory_usage usage;
+        usage.container = sizeof(basic_skip_list);
+        usage.nodes = element_count_ * node_size(0);
+        usage.towers = tower_links_ * per_level;
+        const std::size_t reserved = pool_.reserved_bytes();
+        const std::size_t linked = usage.nodes + usage.towers;
+        usage.slack = reserved > linked ? reserved - linked : 0; // Extracted nodes may live in another pool.
+        return usage;
+    }
+
+    /**
+     * @brief Returns a copy of the search counters (Traits::statistics only).
+     *
+     * With Traits::concurrent_readers the counters are bumped and read with relaxed atomics,
+     * so a snapshot taken while readers run is not a consistent cut across counters.
+     */
+    statistics_type statistics() const noexcept requires uses_statistics {
+        if constexpr (uses_rcu) {
+            const auto load = [](const std::uint64_t& counter) {
+                return std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t&>(counter)).load(std::memory_order_relaxed);
+            };
+            statistics_type snapshot;
+            snapshot.searches = load(statistics_.searches);
+            snapshot.comparisons = load(statistics_.comparisons);
+            snapshot.duplicate_inserts = load(statistics_.duplicate_inserts);
+            snapshot.height_grows = load(statistics_.height_grows);
+            snapshot.height_shrinks = load(statistics_.height_shrinks);
+            for (int i = 0; i < MAX_HEIGHT; ++i) {
+                snapshot.level_hops[i] = load(statistics_.level_hops[i]);
+            }
+            return snapshot;
+        } else {
+            return statistics_;
+        }
+    }
+
+    /// @brief Zeroes the search counters (Traits::statistics only); no reader may be running.
+    void reset_statistics() noexcept requires uses_statistics { statistics_ = statistics_type{}; }
+
     /**
      * @brief Returns an iterator to the first element of the list.
      */
-    iterator begin() const { return iterator(sentinel_head_->forward[0]); }
+    iterator begin() { return make_iterator(load_link(head_tower(), 0)); }
+
+    /// @copydoc begin()
+    const_iterator begin() const { return make_iterator(load_link(head_tower(), 0)); }
+
+    /// @copydoc begin()
+    const_iterator cbegin() const { return begin(); }
     
     /**
      * @brief Returns an iterator pointing past the last element of the list.
+     *
+     * It is a null-node sentinel: building it costs nothing and needs no walk to the tail.
+     */
+    iterator end() { return make_iterator(nullptr); }
+
+    /// @copydoc end()
+    const_iterator end() const { return make_iterator(nullptr); }
+
+    /// @copydoc end()
+    const_iterator cend() const { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the last element (bidirectional lists only).
+     */
+    reverse_iterator rbegin() requires uses_backward { return reverse_iterator(end()); }
+
+    /// @copydoc rbegin()
+    const_reverse_iterator rbegin() const requires uses_backward { return const_reverse_iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator pointing before the first element (bidirectional lists only).
+     */
+    reverse_iterator rend() requires uses_backward { return reverse_iterator(begin()); }
+
+    /// @copydoc rend()
+    const_reverse_iterator rend() const requires uses_backward { return const_reverse_iterator(begin()); }
+
+    /**
+     * @brief Returns the smallest element. The list must not be empty.
+     */
+    const value_type& front() const { return sentinel_head_[0]->value; }
+
+    /**
+     * @brief Returns the largest element in O(1) (bidirectional lists only). The list must not be empty.
+     */
+    const value_type& back() const requires uses_backward { return tail_->value; }
+
+    /**
+     * @brief Removes the smallest element without any search. The list must not be empty.
+     *
+     * Every level the first tower reaches is relinked straight from the sentinel head,
+     * so the cost is the height of that tower, O(1) expected.
+     */
+    void pop_front() {
+        update_path_type update_path;
+        update_path.fill(head_tower());
+        erase_span(update_path.data(), [first = true](const SkipNode*) mutable { return std::exchange(first, false); });
+    }
+
+    /**
+     * @brief Removes the largest element without a descent (bidirectional lists only).
+     *        The list must not be empty.
+     *
+     * The predecessor on each level the last tower reaches is the nearest earlier node that
+     * is tall enough, found by stepping back along the level-0 backward pointers. A
+     * one-level tower (probability 1 - p) is unlinked in O(1).
      */
-    iterator end() const { return iterator(nullptr); }
+    void pop_back() requires uses_backward {
+        SkipNode* last = tail_;
+        const int height = last->height;
+
+        update_path_type update_path;
+        int level = 0;
+        for (SkipNode* node = last->backward; level < height; node = node->backward) {
+            const int reach = node ? std::min(node->height, height) : height;
+            for (; level < reach; ++level) {
+                update_path[level] = tower_of(node);
+            }
+            if (!node) break;
+        }
+
+        // Only null forward pointers follow the last node, so no span width needs fixing.
+        for (int i = 0; i < height; ++i) {
+            store_link(update_path[i], i, nullptr);
+        }
+        tail_ = last->backward;
+        count_towers(height, -1);
+        dispose_node(last);
+
+        trim_height();
+        --element_count_;
+        ++modification_count_;
+    }
+};
+
+/**
+ * @class FastList
+ * @brief A template class that implements a Skip List.
+ *
+ * This class provides logarithmic time complexity on average for search,
+ * insertion, and removal operations. It is an alternative to balanced trees.
+ *
+ * Elements are ordered by `Compare` and two elements `a` and `b` are equivalent when
+ * `!comp(a, b) && !comp(b, a)`. With the default `std::less`, keys providing
+ * `operator<=>` are searched with a single three-way comparison per step.
+ *
+ * @tparam KeyType The type of elements stored in the list. Move-only types are supported.
+ * @tparam Compare A strict weak ordering on keys, `std::less<KeyType>` by default.
+ * @tparam Allocator The allocator node memory is obtained from. It follows the `std::allocator_traits` conventions.
+ * @tparam Traits Compile-time tuning knobs (maximum height, promotion probability), see skip_list_traits.
+ */
+template<typename KeyType, typename Compare = std::less<KeyType>, typename Allocator = std::allocator<KeyType>,
+         typename Traits = skip_list_traits>
+class skip_list
+    : public basic_skip_list<KeyType, skip_list_detail::identity_key, Compare, Allocator, Traits> {
+    using base = basic_skip_list<KeyType, skip_list_detail::identity_key, Compare, Allocator, Traits>;
+
+public:
+    using base::base;
+
+    /**
+     * @brief Default constructor for FastList.
+     *
+     * Initializes an empty list with a sentinel head node.
+     */
+    skip_list() = default;
+
+    /**
+     * @brief Moves the elements not less than `key` into a new list and returns it.
+     *
+     * Only the pointers crossing the cut are rewired and both lists keep sharing the node
+     * memory, see basic_skip_list::split_into() for the cost.
+     * With Traits::concurrent_readers no reader may be running.
+     * @param key The smallest key of the returned list.
+     */
+    skip_list split_at(const KeyType& key) {
+        skip_list tail(this->key_comp(), this->get_allocator());
+        this->split_into(key, tail);
+        return tail;
+    }
 };
 
 #endif // SKIP_LIST_HPP
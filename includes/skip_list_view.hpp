@@ -0,0 +1,365 @@
+/**
+ * @file skip_list_view.hpp
+ * @brief Provides a read-only ordered set served in place from a saved skip list image.
+ *
+ * This file contains the declaration and definition of the skip_list_view class, which
+ * maps an image written by basic_skip_list::save() and searches it without deserializing,
+ * and of save_image(), which writes such an image to a file descriptor. POSIX only.
+ *
+ */
+
+#ifndef SKIP_LIST_VIEW_HPP
+#define SKIP_LIST_VIEW_HPP
+
+#include "skip_list.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Writes the image of a list to a file descriptor, see basic_skip_list::save().
+ *
+ * Short writes are resumed and interrupted ones retried.
+ * @param list The list to save.
+ * @param fd A descriptor open for writing.
+ * @throw std::system_error If a write fails; the descriptor then holds a partial image.
+ */
+template<typename List>
+void save_image(const List& list, int fd) {
+    list.save([fd](const char* data, std::size_t size) {
+        while (size > 0) {
+            const ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(), "save_image: write failed");
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+    });
+}
+
+/**
+ * @class skip_list_view
+ * @brief A read-only ordered set that searches a skip list image where it lies.
+ *
+ * The image is the one written by basic_skip_list::save(): records linked by byte
+ * offsets, searched with the same top-down descent as the list it was saved from.
+ * Opening a file maps it read-only and checks only the header, so start-up costs O(1)
+ * whatever the size of the set, pages are faulted in as lookups reach them, and
+ * processes mapping the same file share its page cache.
+ *
+ * The image is trusted: beyond the header nothing is validated, so only images written
+ * by save() with the same `Key` type and ordering may be opened.
+ *
+ * @tparam Key The type of the keys. It must be trivially copyable.
+ * @tparam Compare The strict weak ordering the image was saved with. If it declares
+ *         `is_transparent`, lookups accept any type comparable with the key.
+ */
+template<typename Key, typename Compare = std::less<Key>>
+class skip_list_view {
+    static_assert(std::is_trivially_copyable_v<Key>, "skip_list_view requires a trivially copyable key type.");
+
+    using record = skip_list_detail::image_record<Key>;
+    using header_type = skip_list_detail::image_header;
+
+    const std::byte* image_ = nullptr; ///< The first byte of the image.
+    std::size_t bytes_ = 0;            ///< The size of the image.
+    std::size_t height_ = 0;           ///< The number of head links.
+    std::size_t count_ = 0;            ///< The number of records.
+    void* mapping_ = nullptr;          ///< The mapping owned by the view, if it opened a file.
+    [[no_unique_address]] Compare comp_;
+
+    /// @brief Returns the links of the record at `offset`, or the head links for offset 0.
+    static const std::uint64_t* links_at(const std::byte* image, std::uint64_t offset) noexcept {
+        const std::byte* at = offset ? image + offset + record::links_offset : image + sizeof(header_type);
+        return reinterpret_cast<const std::uint64_t*>(at);
+    }
+
+    /// @brief Returns the key of the record at `offset`.
+    static const Key& key_at(const std::byte* image, std::uint64_t offset) noexcept {
+        // Trivially copyable types are implicit-lifetime: the mapped bytes hold a Key.
+        return *std::launder(reinterpret_cast<const Key*>(image + offset));
+    }
+
+    /// @brief Resolves `offset` in the image of this view.
+    const std::uint64_t* links_at(std::uint64_t offset) const noexcept { return links_at(image_, offset); }
+    const Key& key_at(std::uint64_t offset) const noexcept { return key_at(image_, offset); }
+
+    /// @brief Returns the offset of the first record whose key is not less than `key`, 0 for none.
+    template<typename K>
+    std::uint64_t search(const K& key) const {
+        const std::uint64_t* links = links_at(0);
+        for (std::size_t level = height_; level-- > 0;) {
+            while (const std::uint64_t next = links[level]) {
+                if (!comp_(key_at(next), key)) break;
+                links = links_at(next);
+            }
+        }
+        return height_ ? links[0] : 0;
+    }
+
+    /// @brief Returns the offset of the first record whose key is greater than `key`, 0 for none.
+    template<typename K>
+    std::uint64_t search_above(const K& key) const {
+        const std::uint64_t* links = links_at(0);
+        for (std::size_t level = height_; level-- > 0;) {
+            while (const std::uint64_t next = links[level]) {
+                if (comp_(key, key_at(next))) break;
+                links = links_at(next);
+            }
+        }
+        return height_ ? links[0] : 0;
+    }
+
+    /// @brief Returns the offset of the record equivalent to `key`, 0 for none.
+    template<typename K>
+    std::uint64_t find_offset(const K& key) const {
+        const std::uint64_t offset = search(key);
+        return offset && !comp_(key, key_at(offset)) ? offset : 0;
+    }
+
+    /// @brief Checks the header of the image against `Key` and the size of the image.
+    void check_header() {
+        header_type header;
+        if (bytes_ < sizeof(header)) {
+            throw std::invalid_argument("skip_list_view: the image is truncated");
+        }
+        std::memcpy(&header, image_, sizeof(header));
+        if (header.magic != header_type::signature || header.version != header_type::current_version) {
+            throw std::invalid_argument("skip_list_view: not a skip list image");
+        }
+        if (header.byte_order != header_type::native_byte_order || header.value_size != sizeof(Key) ||
+            header.value_align != alignof(Key)) {
+            throw std::invalid_argument("skip_list_view: the image was saved with another key layout");
+        }
+        if (header.bytes != bytes_ || header.height > 64 || record::first(header.height) > bytes_ ||
+            header.count > (bytes_ - record::first(header.height)) / record::size(1)) {
+            throw std::invalid_argument("skip_list_view: the image is truncated");
+        }
+        if (reinterpret_cast<std::uintptr_t>(image_) % record::alignment != 0) {
+            throw std::invalid_argument("skip_list_view: the image is misaligned");
+        }
+        height_ = header.height;
+        count_ = header.count;
+    }
+
+    /// @brief Unmaps the file the view opened, if any.
+    void unmap() noexcept {
+        if (mapping_) {
+            ::munmap(mapping_, bytes_);
+        }
+    }
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using reference = const Key&;
+    using const_reference = const Key&;
+
+    /**
+     * @class const_iterator
+     * @brief A forward iterator over the keys of the image, in order.
+     *
+     * Equal to `std::default_sentinel` at the end. Iterators stay valid when the view is moved.
+     */
+    class const_iterator {
+        friend class skip_list_view;
+
+        const std::byte* image_ = nullptr;
+        std::uint64_t offset_ = 0; ///< 0 at the end.
+
+        const_iterator(const std::byte* image, std::uint64_t offset) noexcept : image_(image), offset_(offset) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept  = iterator_category;
+        using value_type        = Key;
+        using reference         = const Key&;
+        using pointer           = const Key*;
+        using difference_type   = std::ptrdiff_t;
+
+        /// @brief Constructs an end iterator.
+        const_iterator() = default;
+
+        /// @brief Dereferences the iterator to access the key.
+        reference operator*() const { return key_at(image_, offset_); }
+
+        /// @brief Accesses a member of the key.
+        pointer operator->() const { return &key_at(image_, offset_); }
+
+        /// @brief Advances the iterator to the next key (prefix).
+        const_iterator& operator++() {
+            if (offset_) offset_ = links_at(image_, offset_)[0];
+            return *this;
+        }
+
+        /// @brief Advances the iterator to the next key (postfix).
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// @brief Compares two iterators for equality.
+        bool operator==(const const_iterator& other) const noexcept { return offset_ == other.offset_; }
+
+        /// @brief Checks whether the iterator has reached the end of the image.
+        bool operator==(std::default_sentinel_t) const noexcept { return offset_ == 0; }
+    };
+    using iterator = const_iterator;
+
+    /**
+     * @brief Serves an image held in memory, which must outlive the view.
+     * @param image The bytes written by save(), aligned like `Key` and to at least 8 bytes.
+     * @param comp The ordering the image was saved with.
+     * @throw std::invalid_argument If the header does not describe an image of `Key` of this size.
+     */
+    explicit skip_list_view(std::span<const std::byte> image, const Compare& comp = Compare())
+        : image_(image.data()), bytes_(image.size()), comp_(comp) {
+        check_header();
+    }
+
+    /**
+     * @brief Maps an image file read-only and serves it.
+     * @param path The file written by save() or save_image().
+     * @param comp The ordering the image was saved with.
+     * @throw std::system_error If the file cannot be opened or mapped.
+     * @throw std::invalid_argument If the header does not describe an image of `Key` of this size.
+     */
+    explicit skip_list_view(const std::string& path, const Compare& comp = Compare()) : comp_(comp) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "skip_list_view: cannot open " + path);
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "skip_list_view: cannot stat " + path);
+        }
+        bytes_ = static_cast<std::size_t>(status.st_size);
+        if (bytes_ < sizeof(header_type)) {
+            ::close(fd);
+            throw std::invalid_argument("skip_list_view: the image is truncated");
+        }
+        void* mapping = ::mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd); // The mapping keeps the file alive.
+        if (mapping == MAP_FAILED) {
+            throw std::system_error(error, std::generic_category(), "skip_list_view: cannot map " + path);
+        }
+        mapping_ = mapping;
+        image_ = static_cast<const std::byte*>(mapping);
+        try {
+            check_header();
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    /// @brief Takes over the image of another view, which is left empty.
+    skip_list_view(skip_list_view&& other) noexcept
+        : image_(std::exchange(other.image_, nullptr)), bytes_(std::exchange(other.bytes_, 0)),
+          height_(std::exchange(other.height_, 0)), count_(std::exchange(other.count_, 0)),
+          mapping_(std::exchange(other.mapping_, nullptr)), comp_(std::move(other.comp_)) {}
+
+    /// @brief Releases the current image and takes over the image of another view.
+    skip_list_view& operator=(skip_list_view&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            image_ = std::exchange(other.image_, nullptr);
+            bytes_ = std::exchange(other.bytes_, 0);
+            height_ = std::exchange(other.height_, 0);
+            count_ = std::exchange(other.count_, 0);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            comp_ = std::move(other.comp_);
+        }
+        return *this;
+    }
+
+    skip_list_view(const skip_list_view&) = delete;
+    skip_list_view& operator=(const skip_list_view&) = delete;
+
+    /// @brief Unmaps the file, if the view opened one.
+    ~skip_list_view() { unmap(); }
+
+    /// @brief Returns the number of keys.
+    size_type size() const noexcept { return count_; }
+
+    /// @brief Checks whether the image holds no key.
+    bool empty() const noexcept { return count_ == 0; }
+
+    /// @brief Returns the comparator that orders the keys.
+    key_compare key_comp() const { return comp_; }
+
+    /// @brief Returns an iterator to the smallest key.
+    const_iterator begin() const noexcept { return const_iterator(image_, height_ ? links_at(0)[0] : 0); }
+
+    /// @brief Returns the past-the-end iterator.
+    const_iterator end() const noexcept { return const_iterator(image_, 0); }
+
+    /**
+     * @brief Checks whether the image holds a key.
+     * @param key The key to look for.
+     * @return `true` if an equivalent key is present.
+     */
+    bool contains(const key_type& key) const { return find_offset(key) != 0; }
+
+    /// @copydoc contains(const key_type&) const
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool contains(const K& key) const { return find_offset(key) != 0; }
+
+    /**
+     * @brief Finds a key.
+     * @param key The key to find.
+     * @return An iterator to the equivalent key, or `end()` if there is none.
+     */
+    const_iterator find(const key_type& key) const { return const_iterator(image_, find_offset(key)); }
+
+    /// @copydoc find(const key_type&) const
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(const K& key) const { return const_iterator(image_, find_offset(key)); }
+
+    /**
+     * @brief Returns an iterator to the first key not less than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator lower_bound(const key_type& key) const { return const_iterator(image_, search(key)); }
+
+    /// @copydoc lower_bound(const key_type&) const
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator lower_bound(const K& key) const { return const_iterator(image_, search(key)); }
+
+    /**
+     * @brief Returns an iterator to the first key greater than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator upper_bound(const key_type& key) const { return const_iterator(image_, search_above(key)); }
+
+    /// @copydoc upper_bound(const key_type&) const
+    template<typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator upper_bound(const K& key) const { return const_iterator(image_, search_above(key)); }
+};
+
+#endif // SKIP_LIST_VIEW_HPP
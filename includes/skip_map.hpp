@@ -0,0 +1,163 @@
+/**
+ * @file skip_map.hpp
+ * @brief Provides an ordered key/value map built on the Skip List engine.
+ *
+ * This file contains the declaration and definition of the skip_map class,
+ * which stores `std::pair<const Key, T>` elements ordered by key.
+ *
+ */
+
+#ifndef SKIP_MAP_HPP
+#define SKIP_MAP_HPP
+
+#include "skip_list.hpp"
+
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+/**
+ * @class skip_map
+ * @brief An ordered associative container mapping unique keys to values.
+ *
+ * Shares its node layout, memory pool and search loop with skip_list. With a
+ * transparent comparator such as `std::less<>`, `find`/`contains`/`erase` accept
+ * any type comparable with the key (for example `std::string_view` for
+ * `std::string` keys), so probes never build a temporary key.
+ *
+ * @tparam Key The type of the keys. It must be comparable with `Compare`.
+ * @tparam T The type of the mapped values.
+ * @tparam Compare A strict weak ordering on keys.
+ * @tparam Allocator The allocator node memory is obtained from. It follows the `std::allocator_traits` conventions.
+ * @tparam Traits Compile-time tuning knobs, see skip_list_traits.
+ */
+template<typename Key, typename T, typename Compare = std::less<Key>,
+         typename Allocator = std::allocator<std::pair<const Key, T>>, typename Traits = skip_list_traits>
+class skip_map
+    : public basic_skip_list<std::pair<const Key, T>, skip_list_detail::select_first, Compare, Allocator, Traits> {
+    using base = basic_skip_list<std::pair<const Key, T>, skip_list_detail::select_first, Compare, Allocator, Traits>;
+
+public:
+    using mapped_type = T;
+    using typename base::key_type;
+    using typename base::value_type;
+    using typename base::iterator;
+    using typename base::const_iterator;
+
+    using base::base;
+
+    /**
+     * @brief Constructs an empty map.
+     */
+    skip_map() = default;
+
+    /**
+     * @brief Moves the entries whose keys are not less than `key` into a new map and returns it.
+     *
+     * Only the pointers crossing the cut are rewired and both maps keep sharing the node
+     * memory, see basic_skip_list::split_into() for the cost.
+     * With Traits::concurrent_readers no reader may be running.
+     * @param key The smallest key of the returned map.
+     */
+    skip_map split_at(const Key& key) {
+        skip_map tail(this->key_comp(), this->get_allocator());
+        this->split_into(key, tail);
+        return tail;
+    }
+
+    /**
+     * @brief Inserts a value constructed from `args` if `key` is not present yet.
+     *
+     * Nothing is constructed (and `args` are not moved from) when the key already exists.
+     * @param key The key to insert.
+     * @param args The arguments the mapped value is constructed from.
+     * @return An iterator to the element holding `key` and whether it was inserted.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        auto [node, inserted] = this->insert_unique(
+            key, std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->make_iterator(node), inserted};
+    }
+
+    /**
+     * @copydoc try_emplace(const key_type&, Args&&...)
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        auto [node, inserted] = this->insert_unique(
+            key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->make_iterator(node), inserted};
+    }
+
+    /**
+     * @brief Assigns `obj` to the value mapped to `key`, inserting it if needed.
+     * @param key The key to insert or update.
+     * @param obj The value to assign.
+     * @return An iterator to the element holding `key` and whether it was inserted.
+     */
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (!result.second) {
+            result.first->second = std::forward<M>(obj);
+        }
+        return result;
+    }
+
+    /**
+     * @copydoc insert_or_assign(const key_type&, M&&)
+     */
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+        auto result = try_emplace(std::move(key), std::forward<M>(obj));
+        if (!result.second) {
+            result.first->second = std::forward<M>(obj);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the value mapped to `key`, value-initializing it if absent.
+     * @param key The key to look up.
+     */
+    mapped_type& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @copydoc operator[](const key_type&)
+     */
+    mapped_type& operator[](key_type&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns the value mapped to `key`.
+     * @param key The key to look up.
+     * @throw std::out_of_range If the key is not present.
+     */
+    mapped_type& at(const key_type& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("skip_map::at: key not found");
+        }
+        return it->second;
+    }
+
+    /**
+     * @copydoc at(const key_type&)
+     */
+    const mapped_type& at(const key_type& key) const {
+        auto it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("skip_map::at: key not found");
+        }
+        return it->second;
+    }
+};
+
+#endif // SKIP_MAP_HPP
@@ -0,0 +1,536 @@
+/**
+ * @file stress_harness.hpp
+ * @brief Provides a multi-threaded throughput, latency and linearizability harness for concurrent sets.
+ *
+ * This file contains the stress namespace: workload descriptions, the run() driver, latency
+ * histograms, a linearizability checker for set histories, and the adapters that make a
+ * skip_list shareable between threads (under one mutex, or with lock-free readers).
+ *
+ */
+
+#ifndef STRESS_HARNESS_HPP
+#define STRESS_HARNESS_HPP
+
+#include "skip_list.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace stress {
+
+/// @brief Draws ranks in [0, n) with Zipfian popularity, after Gray et al., "Quickly generating billion-record synthetic databases".
+class zipfian_generator {
+    std::mt19937_64 engine_;
+    std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+    double n_;
+    double theta_;
+    double zeta_n_ = 0;
+    double alpha_;
+    double eta_;
+
+public:
+    /**
+     * @brief Prepares the distribution in O(n).
+     * @param n The number of ranks.
+     * @param theta The skew, in (0, 1); 0.99 is the YCSB default.
+     * @param seed The seed of the underlying engine.
+     */
+    zipfian_generator(std::uint64_t n, double theta, std::uint64_t seed)
+        : engine_(seed), n_(static_cast<double>(n)), theta_(theta), alpha_(1.0 / (1.0 - theta)) {
+        for (std::uint64_t i = 1; i <= n; ++i) {
+            zeta_n_ += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        const double zeta_2 = 1.0 + std::pow(0.5, theta);
+        eta_ = (1.0 - std::pow(2.0 / n_, 1.0 - theta)) / (1.0 - zeta_2 / zeta_n_);
+    }
+
+    /// @brief Restarts the draws from another seed, keeping the prepared distribution.
+    void seed(std::uint64_t seed) { engine_.seed(seed); }
+
+    /// @brief Draws a rank; rank 0 is the most popular.
+    std::uint64_t operator()() {
+        const double u = uniform_(engine_);
+        const double uz = u * zeta_n_;
+        if (uz < 1.0) return 0;
+        if (uz < 1.0 + std::pow(0.5, theta_)) return 1;
+        const auto rank = static_cast<std::uint64_t>(n_ * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        return std::min(rank, static_cast<std::uint64_t>(n_) - 1);
+    }
+};
+
+/**
+ * @brief Returns a multiplier that permutes [0, n) modulo `n`, used to scatter Zipfian ranks
+ *        so that the popular keys are not neighbours.
+ */
+inline std::uint64_t scatter_multiplier(std::uint64_t n) {
+    std::uint64_t multiplier = 0x9E3779B97F4A7C15ull % n;
+    while (std::gcd(multiplier, n) != 1) {
+        ++multiplier;
+    }
+    return multiplier;
+}
+
+/// @brief How the keys of a workload are drawn from its key range.
+enum class key_distribution {
+    uniform, ///< Every key equally likely.
+    zipfian  ///< Zipf(0.99) popularity, the popular keys scattered over the range.
+};
+
+/// @brief The description of a stress run, see run().
+struct workload {
+    unsigned threads = 4;                      ///< The number of threads issuing operations.
+    unsigned read_percent = 95;                ///< The share of contains(); insert() and erase() split the rest.
+    std::uint64_t key_range = 1 << 16;         ///< Keys are drawn from `[0, key_range)`.
+    key_distribution distribution = key_distribution::uniform;
+    double prefill = 0.5;                      ///< The fraction of the key range inserted before the run.
+    std::uint64_t ops_per_thread = 0;          ///< The operations each thread runs; 0 runs for `duration` instead.
+    std::chrono::milliseconds duration{1000};  ///< The length of a timed run.
+    std::uint64_t seed = 42;                   ///< The seed the prefill and per-thread key streams derive from.
+    bool check_linearizability = false;        ///< Record the history and check it, see find_violation().
+};
+
+/**
+ * @class latency_histogram
+ * @brief A log-linear histogram of latencies in nanoseconds, within about 3% of the true value.
+ *
+ * Values below 32 get a bucket each; every higher power of two is cut into 32 buckets.
+ * Recording is one increment, and histograms of different threads merge by addition.
+ */
+class latency_histogram {
+    static constexpr int sub_bits = 5;
+    static constexpr std::size_t sub_count = std::size_t{1} << sub_bits;
+
+    std::array<std::uint64_t, 64 * sub_count> counts_{};
+
+    static std::size_t bucket(std::uint64_t value) noexcept {
+        if (value < sub_count) {
+            return static_cast<std::size_t>(value);
+        }
+        const int shift = std::bit_width(value) - 1 - sub_bits;
+        return static_cast<std::size_t>(shift + 1) * sub_count + static_cast<std::size_t>((value >> shift) - sub_count);
+    }
+
+    /// @brief Returns the largest value that falls into a bucket.
+    static std::uint64_t bucket_max(std::size_t index) noexcept {
+        if (index < sub_count) {
+            return index;
+        }
+        const int shift = static_cast<int>(index / sub_count) - 1;
+        return ((sub_count + index % sub_count + 1) << shift) - 1;
+    }
+
+public:
+    /// @brief Records one latency.
+    void record(std::uint64_t nanoseconds) noexcept { ++counts_[bucket(nanoseconds)]; }
+
+    /// @brief Adds the samples of another histogram.
+    void merge(const latency_histogram& other) noexcept {
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+    }
+
+    /// @brief Returns the number of recorded samples.
+    std::uint64_t count() const noexcept { return std::accumulate(counts_.begin(), counts_.end(), std::uint64_t{0}); }
+
+    /**
+     * @brief Returns the latency `quantile` of the samples are at or below, rounded up to its bucket.
+     * @param quantile The quantile, in (0, 1]: 0.5 for the median, 0.999 for p99.9.
+     * @return The latency in nanoseconds, 0 without samples.
+     */
+    std::uint64_t percentile(double quantile) const noexcept {
+        const std::uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(quantile * static_cast<double>(total))));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return bucket_max(i);
+            }
+        }
+        return bucket_max(counts_.size() - 1);
+    }
+};
+
+/// @brief The kind of a recorded set operation.
+enum class operation_kind : std::uint8_t { insert, erase, contains };
+
+/// @brief One completed operation of a history, stamped from a shared counter.
+struct operation {
+    std::uint64_t key;
+    std::uint64_t call;   ///< The stamp taken right before the call.
+    std::uint64_t ret;    ///< The stamp taken right after the call returned; `call < ret`.
+    operation_kind kind;
+    bool result;          ///< What insert(), erase() or contains() returned.
+};
+
+namespace detail {
+
+/// @brief Applies an operation to the state of one key; false if its result is impossible there.
+inline bool apply(const operation& op, bool& present) noexcept {
+    switch (op.kind) {
+    case operation_kind::insert:
+        if (op.result == present) return false;
+        present = true;
+        return true;
+    case operation_kind::erase:
+        if (op.result != present) return false;
+        present = false;
+        return true;
+    case operation_kind::contains:
+        return op.result == present;
+    }
+    return false;
+}
+
+/// @brief A set of linearized operations together with the key state they lead to.
+struct configuration {
+    std::vector<std::uint64_t> linearized;
+    bool present;
+
+    bool operator==(const configuration&) const = default;
+};
+
+struct configuration_hash {
+    std::size_t operator()(const configuration& c) const noexcept {
+        std::uint64_t hash = c.present ? 0x9E3779B97F4A7C15ull : 0;
+        for (std::uint64_t word : c.linearized) {
+            hash = (hash ^ word) * 0x100000001B3ull;
+            hash ^= hash >> 29;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+/**
+ * @brief Checks the history of one key, which starts absent.
+ *
+ * The Wing and Gong search with Lowe's memoization: calls and returns are walked in
+ * stamp order, each pending call is tentatively linearized if its result fits the state,
+ * reaching a return whose call is not linearized yet backtracks, and a configuration
+ * (linearized set, state) already explored is never explored twice.
+ */
+inline bool linearizable(std::span<const operation* const> ops) {
+    struct entry {
+        std::uint64_t stamp;
+        std::size_t op;
+        bool call;
+        std::size_t match; ///< The other entry of the same operation.
+        std::size_t prev;
+        std::size_t next;
+    };
+    const std::size_t n = ops.size();
+    std::vector<entry> entries(2 * n + 1); // Entry 0 heads the circular list.
+    {
+        std::vector<std::pair<std::uint64_t, std::size_t>> events; // (stamp, 2 * op + is_return)
+        events.reserve(2 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            events.emplace_back(ops[i]->call, 2 * i);
+            events.emplace_back(ops[i]->ret, 2 * i + 1);
+        }
+        std::sort(events.begin(), events.end());
+        std::vector<std::size_t> call_entry(n);
+        for (std::size_t position = 0; position < events.size(); ++position) {
+            const std::size_t index = position + 1;
+            const std::size_t op = events[position].second / 2;
+            const bool call = events[position].second % 2 == 0;
+            entries[index] = {events[position].first, op, call, 0, index - 1, (index + 1) % entries.size()};
+            if (call) {
+                call_entry[op] = index;
+            } else {
+                entries[index].match = call_entry[op];
+                entries[call_entry[op]].match = index;
+            }
+        }
+        entries[0].next = n ? 1 : 0;
+        entries[0].prev = 2 * n;
+    }
+    const auto unlink = [&entries](std::size_t i) {
+        entries[entries[i].prev].next = entries[i].next;
+        entries[entries[i].next].prev = entries[i].prev;
+    };
+    const auto relink = [&entries](std::size_t i) {
+        entries[entries[i].prev].next = i;
+        entries[entries[i].next].prev = i;
+    };
+
+    configuration current{std::vector<std::uint64_t>((n + 63) / 64), false};
+    std::unordered_set<configuration, configuration_hash> explored;
+    std::vector<std::pair<std::size_t, bool>> linearized; // (call entry, state before it)
+    std::size_t at = entries[0].next;
+    while (entries[0].next != 0) {
+        const entry& e = entries[at];
+        if (e.call) {
+            bool present = current.present;
+            if (apply(*ops[e.op], present)) {
+                current.linearized[e.op / 64] ^= std::uint64_t{1} << (e.op % 64);
+                const bool was_present = std::exchange(current.present, present);
+                if (explored.insert(current).second) {
+                    linearized.emplace_back(at, was_present);
+                    unlink(at);
+                    unlink(e.match);
+                    at = entries[0].next;
+                    continue;
+                }
+                current.present = was_present;
+                current.linearized[e.op / 64] ^= std::uint64_t{1} << (e.op % 64);
+            }
+            at = e.next;
+        } else {
+            if (linearized.empty()) {
+                return false;
+            }
+            const auto [call, was_present] = linearized.back();
+            linearized.pop_back();
+            current.present = was_present;
+            current.linearized[entries[call].op / 64] ^= std::uint64_t{1} << (entries[call].op % 64);
+            relink(entries[call].match);
+            relink(call);
+            at = entries[call].next;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks that a history of set operations is linearizable, every key starting absent.
+ *
+ * Linearizability is local and every operation touches a single key, so the history is
+ * split by key and each key is checked on its own as a boolean register.
+ * @param history The completed operations, in any order.
+ * @return A key whose operations admit no linearization, or nothing if the history is linearizable.
+ */
+inline std::optional<std::uint64_t> find_violation(std::span<const operation> history) {
+    std::vector<const operation*> ops(history.size());
+    std::transform(history.begin(), history.end(), ops.begin(), [](const operation& op) { return &op; });
+    std::sort(ops.begin(), ops.end(), [](const operation* a, const operation* b) { return a->key < b->key; });
+    for (auto first = ops.begin(); first != ops.end();) {
+        const auto last = std::find_if(first, ops.end(), [key = (*first)->key](const operation* op) { return op->key != key; });
+        if (!detail::linearizable(std::span<const operation* const>(&*first, static_cast<std::size_t>(last - first)))) {
+            return (*first)->key;
+        }
+        first = last;
+    }
+    return std::nullopt;
+}
+
+/// @brief The measurements of a stress run.
+struct result {
+    unsigned threads = 0;
+    std::uint64_t operations = 0;   ///< The operations run by all threads, prefill excluded.
+    double seconds = 0;             ///< The wall time from the start signal until every thread finished.
+    latency_histogram reads;        ///< The latencies of contains().
+    latency_histogram writes;       ///< The latencies of insert() and erase().
+    bool checked = false;           ///< Whether the history was checked for linearizability.
+    std::optional<std::uint64_t> violation; ///< A key with a non-linearizable history, if checked and found.
+
+    /// @brief Returns the throughput of the run.
+    double ops_per_second() const noexcept { return seconds > 0 ? static_cast<double>(operations) / seconds : 0; }
+
+    /// @brief Returns the latency histogram of all operations.
+    latency_histogram latencies() const noexcept {
+        latency_histogram all = reads;
+        all.merge(writes);
+        return all;
+    }
+};
+
+/**
+ * @brief Runs a workload against a freshly constructed set and measures it.
+ *
+ * The set is prefilled from one thread, then `w.threads` threads are released at once and
+ * each draws operations and keys from its own generator, timing every call with
+ * `steady_clock`. In checking mode every call is also stamped before and after from a
+ * shared atomic counter, which orders non-overlapping calls as they happened in real
+ * time, and the merged history is checked by find_violation() afterwards. The counter is
+ * a contended cache line, so checking runs measure correctness rather than throughput.
+ * @tparam Set A thread-safe set with `key_type`, default construction and `bool`
+ *         insert(), erase() and contains(), such as concurrent_skip_list, sharded_skip_list,
+ *         locked_set or single_writer_set.
+ * @param w The workload to run.
+ */
+template<typename Set>
+result run(const workload& w) {
+    using key_type = typename Set::key_type;
+    using clock = std::chrono::steady_clock;
+
+    Set set;
+    std::atomic<std::uint64_t> stamps{0};
+    std::vector<operation> prefill_history;
+    {
+        std::mt19937_64 g(w.seed);
+        const auto count = static_cast<std::uint64_t>(w.prefill * static_cast<double>(w.key_range));
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const std::uint64_t key = g() % w.key_range;
+            const std::uint64_t call = stamps.fetch_add(1, std::memory_order_relaxed);
+            const bool inserted = set.insert(static_cast<key_type>(key));
+            if (w.check_linearizability) {
+                prefill_history.push_back({key, call, stamps.fetch_add(1, std::memory_order_relaxed), operation_kind::insert, inserted});
+            }
+        }
+    }
+
+    struct alignas(64) worker {
+        latency_histogram reads;
+        latency_histogram writes;
+        std::vector<operation> history;
+        std::uint64_t operations = 0;
+    };
+    std::vector<worker> workers(w.threads);
+    std::optional<zipfian_generator> zipf;
+    if (w.distribution == key_distribution::zipfian) {
+        zipf.emplace(w.key_range, 0.99, w.seed);
+    }
+    const std::uint64_t scatter = scatter_multiplier(w.key_range);
+
+    std::atomic<bool> stop{false};
+    std::latch start(static_cast<std::ptrdiff_t>(w.threads) + 1);
+    std::vector<std::thread> threads;
+    threads.reserve(w.threads);
+    for (unsigned t = 0; t < w.threads; ++t) {
+        threads.emplace_back([&, t] {
+            worker& self = workers[t];
+            std::mt19937_64 g(w.seed + 1 + t);
+            std::optional<zipfian_generator> keys = zipf;
+            if (keys) {
+                keys->seed(w.seed + 1 + t);
+            }
+            if (w.check_linearizability && w.ops_per_thread) {
+                self.history.reserve(w.ops_per_thread);
+            }
+            start.arrive_and_wait();
+            while (w.ops_per_thread ? self.operations < w.ops_per_thread : !stop.load(std::memory_order_relaxed)) {
+                const std::uint64_t key = keys ? (*keys)() * scatter % w.key_range : g() % w.key_range;
+                const std::uint64_t draw = g() % 200;
+                const operation_kind kind = draw < 2 * w.read_percent ? operation_kind::contains
+                                            : draw % 2 == 0          ? operation_kind::insert
+                                                                     : operation_kind::erase;
+                const std::uint64_t call = w.check_linearizability ? stamps.fetch_add(1, std::memory_order_acq_rel) : 0;
+                const auto begin = clock::now();
+                bool outcome;
+                switch (kind) {
+                case operation_kind::insert: outcome = set.insert(static_cast<key_type>(key)); break;
+                case operation_kind::erase: outcome = set.erase(static_cast<key_type>(key)); break;
+                default: outcome = set.contains(static_cast<key_type>(key)); break;
+                }
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - begin);
+                if (w.check_linearizability) {
+                    self.history.push_back({key, call, stamps.fetch_add(1, std::memory_order_acq_rel), kind, outcome});
+                }
+                (kind == operation_kind::contains ? self.reads : self.writes).record(static_cast<std::uint64_t>(elapsed.count()));
+                ++self.operations;
+            }
+        });
+    }
+
+    start.arrive_and_wait();
+    const auto begin = clock::now();
+    if (!w.ops_per_thread) {
+        std::this_thread::sleep_for(w.duration);
+        stop.store(true, std::memory_order_relaxed);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    result r;
+    r.threads = w.threads;
+    r.seconds = std::chrono::duration<double>(clock::now() - begin).count();
+    std::vector<operation> history = std::move(prefill_history);
+    for (const worker& self : workers) {
+        r.operations += self.operations;
+        r.reads.merge(self.reads);
+        r.writes.merge(self.writes);
+        history.insert(history.end(), self.history.begin(), self.history.end());
+    }
+    if (w.check_linearizability) {
+        r.checked = true;
+        r.violation = find_violation(history);
+    }
+    return r;
+}
+
+/**
+ * @class locked_set
+ * @brief Shares a set between threads behind one mutex: the baseline every concurrent variant is measured against.
+ * @tparam List The set to wrap, skip_list by default.
+ */
+template<typename List = skip_list<std::uint64_t>>
+class locked_set {
+    std::mutex mutex_;
+    List list_;
+
+public:
+    using key_type = typename List::key_type;
+
+    bool insert(const key_type& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.insert(key);
+    }
+
+    bool erase(const key_type& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.erase(key);
+    }
+
+    bool contains(const key_type& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.contains(key);
+    }
+};
+
+/// @brief The tuning knobs of the list single_writer_set wraps by default.
+struct concurrent_reader_traits : skip_list_traits {
+    static constexpr bool concurrent_readers = true;
+};
+
+/**
+ * @class single_writer_set
+ * @brief Shares a skip list with Traits::concurrent_readers: writers take turns on a mutex,
+ *        readers run lock-free alongside them.
+ * @tparam List A skip list whose traits enable concurrent_readers.
+ */
+template<typename List = skip_list<std::uint64_t, std::less<std::uint64_t>, std::allocator<std::uint64_t>, concurrent_reader_traits>>
+class single_writer_set {
+    std::mutex writer_;
+    List list_;
+
+public:
+    using key_type = typename List::key_type;
+
+    bool insert(const key_type& key) {
+        std::lock_guard<std::mutex> lock(writer_);
+        return list_.insert(key);
+    }
+
+    bool erase(const key_type& key) {
+        std::lock_guard<std::mutex> lock(writer_);
+        return list_.erase(key);
+    }
+
+    bool contains(const key_type& key) const { return list_.contains(key); }
+};
+
+} // namespace stress
+
+#endif // STRESS_HARNESS_HPP
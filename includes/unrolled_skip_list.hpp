@@ -0,0 +1,657 @@
+/**
+ * @file unrolled_skip_list.hpp
+ * @brief Provides an ordered set whose skip list nodes each hold a cache line of sorted keys.
+ *
+ * This file contains the declaration and definition of the unrolled_skip_list class and
+ * of the SIMD rank kernels it searches its blocks with.
+ *
+ */
+
+#ifndef UNROLLED_SKIP_LIST_HPP
+#define UNROLLED_SKIP_LIST_HPP
+
+#include "skip_list.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace skip_list_detail {
+
+/// @brief Whether count_less_simd() supports `Key` on the target the translation unit is built for.
+template<typename Key>
+inline constexpr bool simd_rank_supported =
+    std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+#if defined(__AVX2__) || defined(__SSE4_2__)
+    true;
+#elif defined(__SSE2__)
+    sizeof(Key) <= 4;
+#else
+    false;
+#endif
+
+/**
+ * @brief Counts the keys less than `key` in a 64-byte, 64-byte aligned block of integers.
+ *
+ * Every lane is compared at once with a signed compare-greater; unsigned keys are biased
+ * by their sign bit first. Unused lanes must hold the largest value of `Key`, which is
+ * never less than `key`.
+ */
+template<typename Key>
+unsigned count_less_simd(const Key* block, Key key) noexcept {
+    static_assert(simd_rank_supported<Key>, "No SIMD rank kernel for this key type on this target.");
+    using lane = std::make_signed_t<Key>;
+    const lane bias = std::is_signed_v<Key> ? lane{0} : std::numeric_limits<lane>::min();
+    const lane probe = static_cast<lane>(static_cast<lane>(key) ^ bias);
+    unsigned bits = 0;
+#if defined(__AVX2__)
+    const auto broadcast = [](lane value) {
+        if constexpr (sizeof(Key) == 1) return _mm256_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(Key) == 2) return _mm256_set1_epi16(static_cast<short>(value));
+        else if constexpr (sizeof(Key) == 4) return _mm256_set1_epi32(static_cast<int>(value));
+        else return _mm256_set1_epi64x(static_cast<long long>(value));
+    };
+    const auto greater = [](__m256i a, __m256i b) {
+        if constexpr (sizeof(Key) == 1) return _mm256_cmpgt_epi8(a, b);
+        else if constexpr (sizeof(Key) == 2) return _mm256_cmpgt_epi16(a, b);
+        else if constexpr (sizeof(Key) == 4) return _mm256_cmpgt_epi32(a, b);
+        else return _mm256_cmpgt_epi64(a, b);
+    };
+    const __m256i needle = broadcast(probe);
+    const __m256i flip = broadcast(bias);
+    for (int part = 0; part < 2; ++part) {
+        const __m256i lanes = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(block) + part), flip);
+        bits += static_cast<unsigned>(std::popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(greater(needle, lanes)))));
+    }
+#elif defined(__SSE2__)
+    const auto broadcast = [](lane value) {
+        if constexpr (sizeof(Key) == 1) return _mm_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(Key) == 2) return _mm_set1_epi16(static_cast<short>(value));
+        else if constexpr (sizeof(Key) == 4) return _mm_set1_epi32(static_cast<int>(value));
+        else return _mm_set1_epi64x(static_cast<long long>(value));
+    };
+    const auto greater = [](__m128i a, __m128i b) {
+        if constexpr (sizeof(Key) == 1) return _mm_cmpgt_epi8(a, b);
+        else if constexpr (sizeof(Key) == 2) return _mm_cmpgt_epi16(a, b);
+        else if constexpr (sizeof(Key) == 4) return _mm_cmpgt_epi32(a, b);
+        else return _mm_cmpgt_epi64(a, b); // SSE4.2, guaranteed by simd_rank_supported.
+    };
+    const __m128i needle = broadcast(probe);
+    const __m128i flip = broadcast(bias);
+    for (int part = 0; part < 4; ++part) {
+        const __m128i lanes = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(block) + part), flip);
+        bits += static_cast<unsigned>(std::popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(greater(needle, lanes)))));
+    }
+#else
+    static_cast<void>(block);
+    static_cast<void>(probe);
+#endif
+    return bits / sizeof(Key);
+}
+
+} // namespace skip_list_detail
+
+/**
+ * @class unrolled_skip_list
+ * @brief An ordered set of unique keys stored a cache line at a time in skip list blocks.
+ *
+ * Each node is a block holding up to `block_capacity` sorted keys (as many as fit in 64
+ * bytes, at least 4); the towers index blocks by their smallest key. A block starts with
+ * a header line holding its count, height, a copy of its smallest key and its tower,
+ * followed by the 64-byte aligned line of keys. A search descends the towers reading
+ * only header lines, one per hop (two for the few towers taller than the header line
+ * holds), and ranks the key inside the final block's key line.
+ *
+ * A block of `int` or `std::uint64_t` keys with a tower of up to 7 or 6 levels thus takes
+ * 128 bytes: 8 or 16 bytes a key when full, about 11 or 23 at the fill blocks average
+ * after random insertions, against about 24 or 32 for skip_list.
+ * The number of level-0 hops is divided by the block capacity: 16 for `int`, 8 for
+ * `std::uint64_t`. benchmarks/bench_unrolled.cpp reports the bytes per key of both.
+ *
+ * For integral keys ordered by `std::less` the in-block rank is a SIMD compare and
+ * movemask over the whole line (AVX2 when enabled at build time, else SSE), unused slots
+ * holding the largest key; other keys and orderings use a branch-free scalar loop.
+ *
+ * A full block splits in half on insertion. erase() unlinks a block it empties and merges
+ * the block it erased from into a neighbour once both fit in half a block.
+ *
+ * Iterators and references are invalidated by every insertion and erasure, since keys
+ * move within and between blocks.
+ *
+ * @tparam Key The type of the keys. It must be trivially copyable.
+ * @tparam Compare A strict weak ordering on keys.
+ * @tparam Allocator The allocator block memory is obtained from.
+ * @tparam Traits Compile-time tuning knobs; only max_height, promotion_shift and
+ *         level_generator of skip_list_traits apply.
+ */
+template<typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>,
+         typename Traits = skip_list_traits>
+class unrolled_skip_list {
+    static_assert(std::is_trivially_copyable_v<Key>, "unrolled_skip_list moves keys with memmove.");
+    static_assert(Traits::max_height >= 1 && Traits::max_height <= 64, "max_height must be in [1, 64].");
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using level_generator = typename Traits::level_generator;
+
+    /// The number of keys a block holds.
+    static constexpr size_type block_capacity = std::max<size_type>(4, 64 / sizeof(Key));
+
+private:
+    static constexpr int MAX_HEIGHT = Traits::max_height;
+    static constexpr int PROMOTION_SHIFT = Traits::promotion_shift;
+    static constexpr size_type block_align = 64;
+
+    /// Whether blocks are ranked with count_less_simd().
+    static constexpr bool uses_simd = skip_list_detail::simd_rank_supported<Key> &&
+                                      sizeof(Key) * block_capacity == 64 &&
+                                      (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>);
+
+    /**
+     * @brief The header of a block, followed in memory by its tower of `height` forward
+     *        pointers and then, at the next 64-byte boundary, by its `block_capacity` keys.
+     */
+    struct alignas(void*) block {
+        std::uint16_t count;  ///< The number of keys in use, at least 1 for a linked block.
+        std::uint16_t height; ///< The number of forward pointers trailing the header.
+        Key first;            ///< A copy of the smallest key, so the descent reads the header line only.
+
+        /// @brief Returns the tower of forward pointers stored right after the header.
+        block** forward() noexcept { return reinterpret_cast<block**>(this + 1); }
+
+        /// @brief Returns the `count` sorted keys, then padding (the largest key when ranked with SIMD).
+        Key* keys() noexcept { return reinterpret_cast<Key*>(reinterpret_cast<unsigned char*>(this) + keys_offset(height)); }
+
+        /// @copydoc keys()
+        const Key* keys() const noexcept {
+            return reinterpret_cast<const Key*>(reinterpret_cast<const unsigned char*>(this) + keys_offset(height));
+        }
+    };
+
+    using tower_ptr = block**;
+    using update_path_type = std::array<tower_ptr, MAX_HEIGHT>;
+    using node_pool = skip_list_node_pool<Allocator, block_align, MAX_HEIGHT>;
+
+    /// @brief Returns the offset of the key line of a block: past the header and tower, rounded up to a line.
+    static constexpr std::size_t keys_offset(int height) noexcept {
+        const std::size_t header = sizeof(block) + static_cast<std::size_t>(height) * sizeof(block*);
+        return (header + block_align - 1) / block_align * block_align;
+    }
+
+    /// @brief Computes the size of the memory holding a block, its tower and its keys.
+    static constexpr std::size_t block_size(int height) noexcept {
+        return keys_offset(height) + block_capacity * sizeof(Key);
+    }
+
+    node_pool pool_;
+    std::array<block*, MAX_HEIGHT> head_{}; ///< The sentinel tower.
+    int current_height_ = 0;
+    size_type size_ = 0;
+    [[no_unique_address]] Compare comp_;
+    [[no_unique_address]] level_generator random_engine_;
+
+    tower_ptr head_tower() const noexcept { return const_cast<tower_ptr>(head_.data()); }
+
+    /// @brief Returns the tower of a block, or the sentinel tower for `nullptr`.
+    tower_ptr tower_of(block* node) const noexcept { return node ? node->forward() : head_tower(); }
+
+    int random_height() {
+        const int height = 1 + std::countr_zero(static_cast<std::uint64_t>(random_engine_())) / PROMOTION_SHIFT;
+        return std::min(height, MAX_HEIGHT);
+    }
+
+    /// @brief Sets the unused slots of a block from `from` on to the padding key.
+    static void pad(block* node, size_type from) noexcept {
+        if constexpr (uses_simd) {
+            std::fill(node->keys() + from, node->keys() + block_capacity, std::numeric_limits<Key>::max());
+        } else {
+            static_cast<void>(node);
+            static_cast<void>(from);
+        }
+    }
+
+    block* create_block(int height) {
+        block* node = ::new (pool_.allocate(height - 1, block_size(height))) block;
+        node->count = 0;
+        node->height = static_cast<std::uint16_t>(height);
+        std::uninitialized_default_construct_n(node->keys(), block_capacity);
+        pad(node, 0);
+        std::uninitialized_fill_n(node->forward(), height, nullptr);
+        return node;
+    }
+
+    void destroy_block(block* node) noexcept { pool_.deallocate(node, node->height - 1); }
+
+    /// @brief Returns the number of keys of a block less than `key`.
+    size_type rank_in(const block* node, const Key& key) const noexcept {
+        if constexpr (uses_simd) {
+            return skip_list_detail::count_less_simd(node->keys(), key);
+        } else {
+            size_type less = 0;
+            for (size_type i = 0; i < node->count; ++i) {
+                less += static_cast<size_type>(comp_(node->keys()[i], key));
+            }
+            return less;
+        }
+    }
+
+    /**
+     * @brief Descends to the last block on every level whose smallest key is less than `key`.
+     * @param key The key to search for.
+     * @param update_path If not null, receives the tower of that block on every level.
+     * @return The level-0 block found, or `nullptr` if no block starts below `key`.
+     */
+    block* search(const Key& key, tower_ptr* update_path = nullptr) const {
+        tower_ptr current = head_tower();
+        block* found = nullptr;
+        for (int i = current_height_ - 1; i >= 0; --i) {
+            while (block* next = current[i]) {
+                if (!comp_(next->first, key)) break;
+                found = next;
+                current = next->forward();
+            }
+            if (update_path) update_path[i] = current;
+        }
+        return found;
+    }
+
+    /// @brief Returns the position of the first key not less than `key` behind the block `search()` found.
+    std::pair<block*, size_type> lower_position(const Key& key) const {
+        block* before = search(key);
+        if (before) {
+            const size_type rank = rank_in(before, key);
+            if (rank < before->count) {
+                return {before, rank};
+            }
+        }
+        return {tower_of(before)[0], 0};
+    }
+
+    /// @brief Links a new block behind `node`, whose predecessors on its upper levels are in `update_path`.
+    void link_after(block* node, block* fresh, tower_ptr* update_path) {
+        for (int i = current_height_; i < fresh->height; ++i) {
+            update_path[i] = head_tower();
+        }
+        for (int i = 0; i < fresh->height; ++i) {
+            tower_ptr before = node && i < node->height ? node->forward() : update_path[i];
+            fresh->forward()[i] = before[i];
+            before[i] = fresh;
+        }
+        current_height_ = std::max<int>(current_height_, fresh->height);
+    }
+
+    /// @brief Unlinks `node`, whose predecessors on every level are `before(level)`, and frees it.
+    template<typename Before>
+    void unlink(block* node, Before before) noexcept {
+        for (int i = 0; i < node->height; ++i) {
+            before(i)[i] = node->forward()[i];
+        }
+        destroy_block(node);
+        while (current_height_ > 0 && !head_[current_height_ - 1]) {
+            --current_height_;
+        }
+    }
+
+    /// @brief Moves the upper half of a full block into a new block linked right behind it.
+    block* split(block* node, tower_ptr* update_path) {
+        block* fresh = create_block(random_height());
+        constexpr size_type half = block_capacity / 2;
+        std::memcpy(fresh->keys(), node->keys() + half, (block_capacity - half) * sizeof(Key));
+        fresh->count = static_cast<std::uint16_t>(block_capacity - half);
+        fresh->first = fresh->keys()[0];
+        node->count = static_cast<std::uint16_t>(half);
+        pad(node, half);
+        link_after(node, fresh, update_path);
+        return fresh;
+    }
+
+    /// @brief Appends copies of the blocks of another list, keeping their heights.
+    void append_blocks(const unrolled_skip_list& other) {
+        update_path_type tail;
+        tail.fill(head_tower());
+        for (block* source = other.head_[0]; source; source = source->forward()[0]) {
+            block* copy = create_block(source->height);
+            std::memcpy(copy->keys(), source->keys(), block_capacity * sizeof(Key));
+            copy->count = source->count;
+            copy->first = source->first;
+            for (int i = 0; i < copy->height; ++i) {
+                tail[i][i] = copy;
+                tail[i] = copy->forward();
+            }
+        }
+        current_height_ = other.current_height_;
+        size_ = other.size_;
+    }
+
+public:
+    /**
+     * @class const_iterator
+     * @brief A forward iterator over the keys in order: a block and a slot in it.
+     *
+     * Equal to `std::default_sentinel` at the end of the list.
+     */
+    class const_iterator {
+        friend class unrolled_skip_list;
+
+        block* block_ = nullptr;
+        size_type slot_ = 0;
+
+        const_iterator(block* node, size_type slot) noexcept : block_(node), slot_(slot) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept  = iterator_category;
+        using value_type        = Key;
+        using reference         = const Key&;
+        using pointer           = const Key*;
+        using difference_type   = std::ptrdiff_t;
+
+        /// @brief Constructs an end iterator.
+        const_iterator() = default;
+
+        /// @brief Dereferences the iterator to access the key.
+        reference operator*() const { return block_->keys()[slot_]; }
+
+        /// @brief Accesses the key.
+        pointer operator->() const { return &block_->keys()[slot_]; }
+
+        /// @brief Advances the iterator to the next key (prefix).
+        const_iterator& operator++() {
+            if (++slot_ == block_->count) {
+                block_ = block_->forward()[0];
+                slot_ = 0;
+            }
+            return *this;
+        }
+
+        /// @brief Advances the iterator to the next key (postfix).
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// @brief Compares two iterators for equality.
+        bool operator==(const const_iterator& other) const noexcept {
+            return block_ == other.block_ && slot_ == other.slot_;
+        }
+
+        /// @brief Checks whether the iterator has reached the end of the list.
+        bool operator==(std::default_sentinel_t) const noexcept { return block_ == nullptr; }
+    };
+    using iterator = const_iterator;
+
+    /**
+     * @brief Constructs an empty list.
+     * @param comp The ordering of the keys.
+     * @param alloc The allocator block memory is obtained from.
+     */
+    explicit unrolled_skip_list(const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : pool_(alloc), comp_(comp) {}
+
+    /**
+     * @brief Constructs a list from a range of keys; duplicates are skipped.
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template<std::input_iterator InputIt>
+    unrolled_skip_list(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : unrolled_skip_list(comp, alloc) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /// @brief Copies another list block by block, keeping its tower heights.
+    unrolled_skip_list(const unrolled_skip_list& other)
+        : pool_(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())),
+          comp_(other.comp_), random_engine_(other.random_engine_) {
+        append_blocks(other);
+    }
+
+    /// @brief Takes over the blocks of another list, which is left empty.
+    unrolled_skip_list(unrolled_skip_list&& other) noexcept
+        : pool_(std::move(other.pool_)), head_(std::exchange(other.head_, {})),
+          current_height_(std::exchange(other.current_height_, 0)), size_(std::exchange(other.size_, 0)),
+          comp_(other.comp_), random_engine_(other.random_engine_) {}
+
+    /// @brief Replaces the contents with a copy of another list.
+    unrolled_skip_list& operator=(const unrolled_skip_list& other) {
+        if (this != &other) {
+            unrolled_skip_list(other).swap(*this);
+        }
+        return *this;
+    }
+
+    /// @brief Replaces the contents with those of another list, which is left empty.
+    unrolled_skip_list& operator=(unrolled_skip_list&& other) noexcept {
+        unrolled_skip_list(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /// @brief Exchanges the contents of two lists.
+    void swap(unrolled_skip_list& other) noexcept {
+        using std::swap;
+        pool_.swap(other.pool_);
+        swap(head_, other.head_);
+        swap(current_height_, other.current_height_);
+        swap(size_, other.size_);
+        swap(comp_, other.comp_);
+        swap(random_engine_, other.random_engine_);
+    }
+
+    /// @copydoc swap(unrolled_skip_list&)
+    friend void swap(unrolled_skip_list& a, unrolled_skip_list& b) noexcept { a.swap(b); }
+
+    /// @brief Returns a copy of the allocator block memory is obtained from.
+    allocator_type get_allocator() const { return allocator_type(pool_.get_allocator()); }
+
+    /// @brief Returns the comparator that orders the keys.
+    key_compare key_comp() const { return comp_; }
+
+    /// @brief Returns the number of keys.
+    size_type size() const noexcept { return size_; }
+
+    /// @brief Checks whether the list is empty.
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Returns the number of blocks, for measuring fill and pointer overhead.
+    size_type block_count() const noexcept {
+        size_type blocks = 0;
+        for (block* node = head_[0]; node; node = node->forward()[0]) {
+            ++blocks;
+        }
+        return blocks;
+    }
+
+    /**
+     * @brief Reports the memory held by the list, see skip_list_memory_usage.
+     *
+     * `nodes` counts the block headers, the padding up to the key lines and the key lines,
+     * `towers` the forward pointers. Walks the blocks, costing O(size() / block_capacity).
+     */
+    skip_list_memory_usage memory_usage() const noexcept {
+        skip_list_memory_usage usage;
+        usage.container = sizeof(unrolled_skip_list);
+        for (block* node = head_[0]; node; node = node->forward()[0]) {
+            usage.towers += node->height * sizeof(block*);
+            usage.nodes += block_size(node->height) - node->height * sizeof(block*);
+        }
+        const std::size_t reserved = pool_.reserved_bytes();
+        const std::size_t linked = usage.nodes + usage.towers;
+        usage.slack = reserved > linked ? reserved - linked : 0;
+        return usage;
+    }
+
+    /// @brief Removes every key, returning block memory to the allocator slab by slab.
+    void clear() noexcept {
+        pool_.release();
+        head_.fill(nullptr);
+        current_height_ = 0;
+        size_ = 0;
+    }
+
+    /// @brief Returns an iterator to the smallest key.
+    const_iterator begin() const noexcept { return const_iterator(head_[0], 0); }
+
+    /// @brief Returns the past-the-end iterator.
+    const_iterator end() const noexcept { return const_iterator(); }
+
+    /**
+     * @brief Inserts a key if it is not present yet.
+     * @param key The key to insert.
+     * @return `true` if the key was inserted, `false` if it was already present.
+     */
+    bool insert(const Key& key) {
+        update_path_type update_path;
+        block* before = search(key, update_path.data());
+        block* next = tower_of(before)[0];
+        if (next && !comp_(key, next->first)) {
+            return false; // The smallest key of the next block.
+        }
+
+        block* target = before ? before : next;
+        size_type slot = 0;
+        if (!target) {
+            target = create_block(random_height());
+            link_after(nullptr, target, update_path.data());
+        } else {
+            slot = before ? rank_in(before, key) : 0;
+            if (before && slot < before->count && !comp_(key, before->keys()[slot])) {
+                return false;
+            }
+            if (target->count == block_capacity) {
+                block* upper = split(target, update_path.data());
+                if (slot > block_capacity / 2) {
+                    target = upper;
+                    slot -= block_capacity / 2;
+                }
+            }
+        }
+        Key* keys = target->keys();
+        std::memmove(keys + slot + 1, keys + slot, (target->count - slot) * sizeof(Key));
+        keys[slot] = key;
+        ++target->count;
+        if (slot == 0) {
+            target->first = key;
+        }
+        ++size_;
+        return true;
+    }
+
+    /**
+     * @brief Removes a key.
+     * @param key The key to remove.
+     * @return `true` if the key was found and removed.
+     */
+    bool erase(const Key& key) {
+        update_path_type update_path;
+        block* before = search(key, update_path.data());
+        block* next = tower_of(before)[0];
+        block* target;
+        size_type slot;
+        if (next && !comp_(key, next->first)) {
+            target = next;
+            slot = 0;
+        } else if (before && (slot = rank_in(before, key)) < before->count && !comp_(key, before->keys()[slot])) {
+            target = before;
+        } else {
+            return false;
+        }
+
+        Key* keys = target->keys();
+        std::memmove(keys + slot, keys + slot + 1, (target->count - slot - 1) * sizeof(Key));
+        --target->count;
+        pad(target, target->count);
+        if (slot == 0 && target->count > 0) {
+            target->first = keys[0];
+        }
+        --size_;
+
+        // Only `next` can empty, `before` keeps its smallest key. The path holds the predecessors
+        // of `next` on all its levels, and `before` is its predecessor on level 0.
+        if (target == next && (target->count == 0 || (before && before->count + target->count <= block_capacity / 2))) {
+            if (target->count > 0) {
+                std::memcpy(before->keys() + before->count, keys, target->count * sizeof(Key));
+                before->count = static_cast<std::uint16_t>(before->count + target->count);
+            }
+            unlink(target, [&](int i) { return update_path[i]; });
+            return true;
+        }
+        block* successor = target->forward()[0];
+        if (successor && target->count + successor->count <= block_capacity / 2) {
+            std::memcpy(keys + target->count, successor->keys(), successor->count * sizeof(Key));
+            target->count = static_cast<std::uint16_t>(target->count + successor->count);
+            unlink(successor, [&](int i) { return i < target->height ? target->forward() : update_path[i]; });
+        } else if (target == before && target->count <= block_capacity / 4) {
+            // The path does not reach the predecessor of `before`: search again, only for sparse blocks.
+            block* previous = search(target->first, update_path.data());
+            if (previous && previous->count + target->count <= block_capacity / 2) {
+                std::memcpy(previous->keys() + previous->count, keys, target->count * sizeof(Key));
+                previous->count = static_cast<std::uint16_t>(previous->count + target->count);
+                unlink(target, [&](int i) { return update_path[i]; });
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a key is present.
+     * @param key The key to look for.
+     */
+    bool contains(const Key& key) const {
+        const auto [node, slot] = lower_position(key);
+        return node && !comp_(key, node->keys()[slot]);
+    }
+
+    /**
+     * @brief Finds a key.
+     * @param key The key to find.
+     * @return An iterator to the key, or `end()` if it is not present.
+     */
+    const_iterator find(const Key& key) const {
+        const auto [node, slot] = lower_position(key);
+        return node && !comp_(key, node->keys()[slot]) ? const_iterator(node, slot) : end();
+    }
+
+    /**
+     * @brief Returns an iterator to the first key not less than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator lower_bound(const Key& key) const {
+        const auto [node, slot] = lower_position(key);
+        return const_iterator(node, slot);
+    }
+
+    /**
+     * @brief Returns an iterator to the first key greater than `key`.
+     * @param key The key to compare against.
+     */
+    const_iterator upper_bound(const Key& key) const {
+        const_iterator it = lower_bound(key);
+        if (it != end() && !comp_(key, *it)) {
+            ++it;
+        }
+        return it;
+    }
+};
+
+#endif // UNROLLED_SKIP_LIST_HPP
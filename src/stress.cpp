@@ -0,0 +1,144 @@
+// Drives the stress harness from the command line and prints one row per variant and thread count.
+//
+//   skip_list_stress [--variant=all|locked|single-writer|concurrent|sharded] [--threads=1,2,4,8]
+//                    [--mix=95/5] [--keys=65536] [--distribution=uniform|zipfian]
+//                    [--duration-ms=1000] [--ops=N] [--check]
+//
+// --mix gives the percentage of contains() against insert() and erase() together; --ops runs a
+// fixed number of operations per thread instead of a duration; --check records the history and
+// verifies it is linearizable, the exit status being 1 if any variant fails.
+
+#include "concurrent_skip_list.hpp"
+#include "sharded_skip_list.hpp"
+#include "stress_harness.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct options {
+    std::string variant = "all";
+    std::vector<unsigned> threads{1, 2, 4, 8};
+    stress::workload workload;
+};
+
+void usage() {
+    std::fputs("usage: skip_list_stress [--variant=all|locked|single-writer|concurrent|sharded]\n"
+               "                        [--threads=1,2,4,8] [--mix=95/5] [--keys=65536]\n"
+               "                        [--distribution=uniform|zipfian] [--duration-ms=1000]\n"
+               "                        [--ops=N] [--check]\n",
+               stderr);
+}
+
+std::vector<unsigned> parse_list(std::string_view text) {
+    std::vector<unsigned> values;
+    while (!text.empty()) {
+        const std::size_t comma = text.find(',');
+        values.push_back(static_cast<unsigned>(std::stoul(std::string(text.substr(0, comma)))));
+        text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+    }
+    return values;
+}
+
+bool parse(int argc, char** argv, options& o) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const std::size_t equals = arg.find('=');
+        const std::string_view name = arg.substr(0, equals);
+        const std::string value = equals == std::string_view::npos ? std::string() : std::string(arg.substr(equals + 1));
+        try {
+            if (name == "--variant") {
+                o.variant = value;
+            } else if (name == "--threads") {
+                o.threads = parse_list(value);
+            } else if (name == "--mix") {
+                o.workload.read_percent = static_cast<unsigned>(std::stoul(value));
+            } else if (name == "--keys") {
+                o.workload.key_range = std::stoull(value);
+            } else if (name == "--distribution" && (value == "uniform" || value == "zipfian")) {
+                o.workload.distribution = value == "uniform" ? stress::key_distribution::uniform : stress::key_distribution::zipfian;
+            } else if (name == "--duration-ms") {
+                o.workload.duration = std::chrono::milliseconds(std::stoll(value));
+            } else if (name == "--ops") {
+                o.workload.ops_per_thread = std::stoull(value);
+            } else if (name == "--check") {
+                o.workload.check_linearizability = true;
+            } else {
+                return false;
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return o.workload.read_percent <= 100 && o.workload.key_range > 1 && !o.threads.empty();
+}
+
+/// Runs the scaling curve of one variant; returns false if a history failed the check.
+template<typename Set>
+bool sweep(const char* name, const options& o) {
+    bool linearizable = true;
+    for (unsigned threads : o.threads) {
+        stress::workload w = o.workload;
+        w.threads = threads;
+        const stress::result r = stress::run<Set>(w);
+        const stress::latency_histogram all = r.latencies();
+        std::printf("%-14s %7u %14.0f %9llu %9llu %9llu", name, threads, r.ops_per_second(),
+                    static_cast<unsigned long long>(all.percentile(0.5)),
+                    static_cast<unsigned long long>(all.percentile(0.99)),
+                    static_cast<unsigned long long>(all.percentile(0.999)));
+        if (r.checked) {
+            if (r.violation) {
+                std::printf("  violation at key %llu", static_cast<unsigned long long>(*r.violation));
+                linearizable = false;
+            } else {
+                std::printf("  linearizable");
+            }
+        }
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+    return linearizable;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    options o;
+    if (!parse(argc, argv, o)) {
+        usage();
+        return 2;
+    }
+    const auto selected = [&o](std::string_view variant) { return o.variant == "all" || o.variant == variant; };
+
+    std::printf("%-14s %7s %14s %9s %9s %9s   (%u%% reads, %llu %s keys)\n", "variant", "threads", "ops/s",
+                "p50 ns", "p99 ns", "p999 ns", o.workload.read_percent,
+                static_cast<unsigned long long>(o.workload.key_range),
+                o.workload.distribution == stress::key_distribution::uniform ? "uniform" : "zipfian");
+    bool linearizable = true;
+    bool ran = false;
+    if (selected("locked")) {
+        linearizable &= sweep<stress::locked_set<>>("locked", o);
+        ran = true;
+    }
+    if (selected("single-writer")) {
+        linearizable &= sweep<stress::single_writer_set<>>("single-writer", o);
+        ran = true;
+    }
+    if (selected("concurrent")) {
+        linearizable &= sweep<concurrent_skip_list<std::uint64_t>>("concurrent", o);
+        ran = true;
+    }
+    if (selected("sharded")) {
+        linearizable &= sweep<sharded_skip_list<std::uint64_t>>("sharded", o);
+        ran = true;
+    }
+    if (!ran) {
+        usage();
+        return 2;
+    }
+    return linearizable ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,311 @@
+#include "gtest/gtest.h"
+#include "concurrent_skip_list.hpp"
+#include "epoch_domain.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <semaphore>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int thread_count = 8;
+
+template<typename Fn>
+void run_threads(Fn fn) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back(fn, t);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+struct retired_object : epoch_hook {
+    bool reclaimed = false;
+};
+
+void count_reclaim(void* context, epoch_hook* object) noexcept {
+    static_cast<retired_object*>(object)->reclaimed = true;
+    ++*static_cast<int*>(context);
+}
+
+/// Gives every node a tower of three levels, so each key is linked above level 0.
+struct tall_tower_generator {
+    std::uint64_t operator()() const noexcept { return 0b100; }
+};
+
+/// Sleeps now and then inside searches, so that threads interleave mid-operation even on one core.
+struct sleepy_less {
+    bool operator()(int a, int b) const {
+        thread_local unsigned calls = 0;
+        if (++calls % 2 == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        }
+        return a < b;
+    }
+};
+
+struct TallTowerTraits : concurrent_skip_list_traits {
+    static constexpr int promotion_shift = 1;
+    using level_generator = tall_tower_generator;
+};
+
+} // namespace
+
+TEST(ConcurrentSkipListTest, SequentialSemantics) {
+    concurrent_skip_list<int> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+
+    for (int key : {5, 1, 9, 3, 7}) {
+        EXPECT_TRUE(list.insert(key));
+    }
+    EXPECT_FALSE(list.insert(3));
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_TRUE(list.contains(7));
+    EXPECT_FALSE(list.contains(4));
+
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_FALSE(list.erase(1));
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_EQ(list.size(), 4u);
+
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{3, 5, 7, 9}));
+    ASSERT_NE(list.find(7), list.end());
+    EXPECT_EQ(*list.find(7), 7);
+    EXPECT_EQ(list.find(4), list.end());
+    EXPECT_EQ(*list.lower_bound(4), 5);
+    EXPECT_EQ(list.lower_bound(10), list.end());
+}
+
+TEST(ConcurrentSkipListTest, IteratorIsForward) {
+    using list_type = concurrent_skip_list<int>;
+    static_assert(std::forward_iterator<list_type::const_iterator>);
+    static_assert(std::is_same_v<std::iter_reference_t<list_type::iterator>, const int&>);
+
+    list_type list;
+    for (int i = 0; i < 100; ++i) {
+        list.insert(i);
+    }
+    auto it = list.begin();
+    auto copy = it;
+    ++it;
+    EXPECT_EQ(*copy, 0);
+    EXPECT_EQ(*it, 1);
+    copy = it;
+    EXPECT_EQ(copy, it);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 100);
+}
+
+TEST(ConcurrentSkipListTest, MoveOnlyAndHeterogeneousKeys) {
+    concurrent_skip_list<std::string, std::less<>> list;
+    std::string key = "beta";
+    EXPECT_TRUE(list.insert(std::move(key)));
+    EXPECT_TRUE(list.insert(std::string("alpha")));
+    EXPECT_TRUE(list.contains(std::string_view("beta")));
+    EXPECT_EQ(*list.find(std::string_view("alpha")), "alpha");
+    EXPECT_TRUE(list.erase(std::string_view("alpha")));
+    EXPECT_FALSE(list.contains(std::string_view("alpha")));
+}
+
+TEST(ConcurrentSkipListTest, DisjointConcurrentInserts) {
+    constexpr int per_thread = 5000;
+    concurrent_skip_list<int> list;
+    run_threads([&](int t) {
+        for (int i = 0; i < per_thread; ++i) {
+            EXPECT_TRUE(list.insert(i * thread_count + t));
+        }
+    });
+
+    EXPECT_EQ(list.size(), static_cast<std::size_t>(per_thread * thread_count));
+    int expected = 0;
+    for (int key : list) {
+        ASSERT_EQ(key, expected++);
+    }
+    EXPECT_EQ(expected, per_thread * thread_count);
+}
+
+TEST(ConcurrentSkipListTest, RacingInsertsOfTheSameKeys) {
+    constexpr int keys = 2000;
+    concurrent_skip_list<int> list;
+    std::atomic<int> inserted{0};
+    run_threads([&](int) {
+        for (int i = 0; i < keys; ++i) {
+            if (list.insert(i)) {
+                inserted.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+    EXPECT_EQ(inserted.load(), keys);
+    EXPECT_EQ(list.size(), static_cast<std::size_t>(keys));
+    EXPECT_EQ(std::distance(list.begin(), list.end()), keys);
+}
+
+TEST(ConcurrentSkipListTest, MixedInsertEraseContains) {
+    constexpr int key_range = 512;
+    constexpr int operations = 20000;
+    concurrent_skip_list<int> list;
+    std::vector<std::atomic<int>> balance(key_range);
+
+    run_threads([&](int t) {
+        std::mt19937 rng(static_cast<unsigned>(t));
+        for (int i = 0; i < operations; ++i) {
+            const int key = static_cast<int>(rng() % key_range);
+            switch (rng() % 3) {
+            case 0:
+                if (list.insert(key)) {
+                    balance[key].fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            case 1:
+                if (list.erase(key)) {
+                    balance[key].fetch_sub(1, std::memory_order_relaxed);
+                }
+                break;
+            default:
+                list.contains(key);
+                break;
+            }
+        }
+    });
+
+    std::size_t present = 0;
+    for (int key = 0; key < key_range; ++key) {
+        const int net = balance[key].load();
+        ASSERT_TRUE(net == 0 || net == 1) << "key " << key;
+        EXPECT_EQ(list.contains(key), net == 1) << "key " << key;
+        present += static_cast<std::size_t>(net);
+    }
+    EXPECT_EQ(list.size(), present);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(list.begin(), list.end())), present);
+}
+
+TEST(ConcurrentSkipListTest, HotKeyChurnWithTallTowers) {
+    // An insertion can link its upper levels in front of an erased node of the same key;
+    // the eraser must still unlink that node before retiring it.
+    constexpr int hot = 50;
+    concurrent_skip_list<int, sleepy_less, std::allocator<int>, TallTowerTraits> list;
+    for (int key = 0; key <= 2 * hot; key += 10) {
+        if (key != hot) {
+            list.insert(key);
+        }
+    }
+
+    // A fixed duration rather than a fixed count, so the threads overlap even on one core.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    run_threads([&](int t) {
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (t % 3 == 0) {
+                list.insert(hot);
+            } else if (t % 3 == 1) {
+                list.erase(hot);
+                list.collect(); // Frees retired nodes as early as possible.
+            } else {
+                ASSERT_TRUE(list.contains(hot + 10)); // Descends past the hot key on every level.
+                list.contains(hot);
+            }
+        }
+    });
+
+    list.erase(hot);
+    std::vector<int> keys(list.begin(), list.end());
+    EXPECT_EQ(keys, (std::vector<int>{0, 10, 20, 30, 40, 60, 70, 80, 90, 100}));
+    EXPECT_EQ(list.size(), keys.size());
+}
+
+TEST(ConcurrentSkipListTest, IteratorsSurviveConcurrentErasure) {
+    constexpr int key_range = 4096;
+    concurrent_skip_list<int> list;
+    for (int key = 0; key < key_range; key += 2) {
+        list.insert(key); // Even keys are never erased.
+    }
+    std::atomic<bool> stop{false};
+
+    std::thread writer([&] {
+        std::mt19937 rng(7);
+        while (!stop.load(std::memory_order_relaxed)) {
+            const int key = static_cast<int>(rng() % key_range) | 1;
+            list.insert(key);
+            list.erase(key);
+        }
+    });
+
+    for (int pass = 0; pass < 50; ++pass) {
+        int previous = -1;
+        int evens = 0;
+        for (int key : list) {
+            ASSERT_LT(previous, key);
+            previous = key;
+            evens += key % 2 == 0;
+        }
+        EXPECT_EQ(evens, key_range / 2);
+    }
+    stop.store(true);
+    writer.join();
+}
+
+TEST(EpochDomainTest, PinnedReaderDelaysReclamation) {
+    int reclaimed = 0;
+    std::vector<retired_object> objects(3 * epoch_domain::collect_threshold);
+    epoch_domain domain(&count_reclaim, &reclaimed);
+
+    std::binary_semaphore reader_pinned{0};
+    std::binary_semaphore release_reader{0};
+    std::thread reader([&] {
+        epoch_domain::guard guard = domain.pin();
+        reader_pinned.release();
+        release_reader.acquire();
+    });
+    reader_pinned.acquire();
+
+    {
+        epoch_domain::guard guard = domain.pin();
+        for (retired_object& object : objects) {
+            guard.retire(&object);
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        domain.collect();
+    }
+    EXPECT_EQ(reclaimed, 0);
+
+    release_reader.release();
+    reader.join();
+    for (int i = 0; i < 4; ++i) {
+        domain.collect();
+    }
+    EXPECT_EQ(reclaimed, static_cast<int>(objects.size()));
+}
+
+TEST(EpochDomainTest, DestructorReclaimsEverything) {
+    int reclaimed = 0;
+    std::vector<retired_object> objects(10);
+    {
+        epoch_domain domain(&count_reclaim, &reclaimed);
+        epoch_domain::guard outer = domain.pin();
+        {
+            epoch_domain::guard nested = domain.pin();
+            for (retired_object& object : objects) {
+                nested.retire(&object);
+            }
+        }
+        EXPECT_EQ(reclaimed, 0);
+    }
+    EXPECT_EQ(reclaimed, static_cast<int>(objects.size()));
+    EXPECT_TRUE(std::all_of(objects.begin(), objects.end(), [](const retired_object& o) { return o.reclaimed; }));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "frozen_skip_list.hpp"
+#include "skip_map.hpp"
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// Compares every lookup of a frozen list against a sorted reference over [lo, hi).
+template<typename Frozen>
+void ExpectLookupsMatch(const Frozen& frozen, const std::set<int>& reference, int lo, int hi) {
+    ASSERT_EQ(frozen.size(), reference.size());
+    ASSERT_TRUE(std::equal(frozen.begin(), frozen.end(), reference.begin(), reference.end()));
+    for (int key = lo; key < hi; ++key) {
+        ASSERT_EQ(frozen.contains(key), reference.contains(key)) << key;
+        const auto lower = reference.lower_bound(key);
+        const auto upper = reference.upper_bound(key);
+        ASSERT_EQ(frozen.lower_bound(key) - frozen.begin(), std::distance(reference.begin(), lower)) << key;
+        ASSERT_EQ(frozen.upper_bound(key) - frozen.begin(), std::distance(reference.begin(), upper)) << key;
+        ASSERT_EQ(frozen.rank(key), static_cast<std::size_t>(std::distance(reference.begin(), lower)));
+        const auto [first, last] = frozen.equal_range(key);
+        ASSERT_EQ(last - first, reference.contains(key) ? 1 : 0);
+        ASSERT_EQ(frozen.find(key) == frozen.end(), !reference.contains(key));
+    }
+}
+
+struct CaseInsensitiveLess {
+    using is_transparent = void;
+    bool operator()(std::string_view a, std::string_view b) const {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) < std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+};
+
+} // namespace
+
+TEST(FrozenSkipListTest, FreezeKeepsTheLookupApi) {
+    std::mt19937 g(41);
+    for (std::size_t size : {0u, 1u, 2u, 15u, 16u, 17u, 255u, 256u, 257u, 5000u}) {
+        std::set<int> reference;
+        skip_list<int> list;
+        while (reference.size() < size) {
+            const int key = static_cast<int>(g() % (size * 4 + 1));
+            reference.insert(key);
+            list.insert(key);
+        }
+        const frozen_skip_list<int> frozen = list.freeze();
+        ExpectLookupsMatch(frozen, reference, -3, static_cast<int>(size * 4) + 3);
+        EXPECT_EQ(frozen.nth(size), frozen.end());
+        if (size > 0) {
+            EXPECT_EQ(*frozen.nth(size - 1), *reference.rbegin());
+        }
+    }
+}
+
+TEST(FrozenSkipListTest, UnsortedRangesAreSortedAndDeduplicated) {
+    const std::vector<int> keys{5, 3, 9, 3, 1, 5, 7};
+    const frozen_skip_list<int> frozen(keys.begin(), keys.end());
+    EXPECT_EQ(std::vector<int>(frozen.begin(), frozen.end()), (std::vector<int>{1, 3, 5, 7, 9}));
+
+    const frozen_skip_list<int, std::greater<int>> descending(keys.begin(), keys.end());
+    EXPECT_EQ(*descending.begin(), 9);
+    EXPECT_EQ(*descending.lower_bound(6), 5);
+    ExpectLookupsMatch(frozen_skip_list<int>(), {}, -2, 2);
+}
+
+TEST(FrozenSkipListTest, FrozenMapsAndTransparentLookups) {
+    skip_map<std::string, int, CaseInsensitiveLess> map;
+    for (int i = 0; i < 300; ++i) {
+        map.try_emplace("Key" + std::to_string(i), i);
+    }
+    const frozen_skip_map<std::string, int, CaseInsensitiveLess> frozen = map.freeze();
+    ASSERT_EQ(frozen.size(), 300u);
+    EXPECT_EQ(frozen.find(std::string_view("KEY42"))->second, 42);
+    EXPECT_TRUE(frozen.contains(std::string_view("key299")));
+    EXPECT_FALSE(frozen.contains(std::string_view("key300")));
+    EXPECT_EQ(frozen.lower_bound(std::string_view("key3"))->first, "Key3");
+    EXPECT_TRUE(std::equal(frozen.begin(), frozen.end(), map.begin(), map.end()));
+
+    const std::vector<std::pair<const std::string, int>> reversed(map.begin(), map.end());
+    const frozen_skip_map<std::string, int, CaseInsensitiveLess> rebuilt(reversed.rbegin(), reversed.rend());
+    EXPECT_TRUE(std::equal(rebuilt.begin(), rebuilt.end(), map.begin(), map.end()));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
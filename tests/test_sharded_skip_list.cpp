@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+#include "sharded_skip_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Runs every task on the calling thread.
+struct inline_executor {
+    template<typename Task>
+    void operator()(Task task) const { task(); }
+};
+
+template<typename List>
+std::vector<int> scan(const List& list, int lo, int hi) {
+    std::mutex mutex;
+    std::vector<int> keys;
+    list.for_each_range(lo, hi, [&](int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        keys.push_back(key);
+    });
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+/// Shards without span widths, which split in O(n).
+struct UnindexedShardTraits : skip_list_traits {};
+
+} // namespace
+
+TEST(ShardedSkipListTest, BasicOperations) {
+    sharded_skip_list<int, 4> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.shard_count(), 1u);
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_FALSE(list.insert(3));
+    EXPECT_TRUE(list.contains(1));
+    EXPECT_FALSE(list.contains(2));
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_FALSE(list.erase(1));
+    EXPECT_EQ(list.size(), 1u);
+}
+
+TEST(ShardedSkipListTest, GrowingShardsSplitUntilTheLimit) {
+    sharded_skip_list<int, 8> list(100);
+    std::vector<int> keys(2000);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+    for (int key : keys) {
+        ASSERT_TRUE(list.insert(key));
+    }
+    EXPECT_EQ(list.shard_count(), 8u);
+    EXPECT_EQ(list.size(), keys.size());
+    for (int key : keys) {
+        ASSERT_TRUE(list.contains(key)) << key;
+    }
+    EXPECT_FALSE(list.split(0));
+}
+
+TEST(ShardedSkipListTest, ExplicitSplit) {
+    sharded_skip_list<int, 4> list(1 << 20);
+    list.insert(1);
+    EXPECT_FALSE(list.split(0));
+    EXPECT_FALSE(list.split(3));
+    for (int i = 2; i <= 10; ++i) {
+        list.insert(i);
+    }
+    EXPECT_TRUE(list.split(0));
+    EXPECT_TRUE(list.split(1));
+    EXPECT_EQ(list.shard_count(), 3u);
+    for (int i = 1; i <= 10; ++i) {
+        EXPECT_TRUE(list.contains(i)) << i;
+    }
+    EXPECT_TRUE(list.insert(0));
+    EXPECT_TRUE(list.insert(100));
+    EXPECT_EQ(scan(list, -5, 200).size(), 12u);
+}
+
+TEST(ShardedSkipListTest, UnindexedShardsSplitAtTheirMedian) {
+    sharded_skip_list<int, 4, std::less<int>, std::allocator<int>, UnindexedShardTraits> list(1 << 20);
+    for (int i = 0; i < 100; ++i) {
+        list.insert(i);
+    }
+    EXPECT_TRUE(list.split(0));
+    EXPECT_EQ(list.shard_count(), 2u);
+    EXPECT_EQ(scan(list, 0, 50).size(), 50u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(list.contains(i)) << i;
+    }
+}
+
+TEST(ShardedSkipListTest, SplitsRunBesideWritersOfTheSameShard) {
+    // The median is picked under the shared lock; writers may empty either half before the cut.
+    sharded_skip_list<int, 64> list(1 << 20);
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (int round = 0; !stop.load(); ++round) {
+            for (int key = 0; key < 64; ++key) {
+                if (round % 2 == 0) {
+                    list.insert(key);
+                } else {
+                    list.erase(key);
+                }
+            }
+        }
+    });
+    for (int attempt = 0; attempt < 2000 && list.shard_count() < 64; ++attempt) {
+        list.split(static_cast<std::size_t>(attempt) % list.shard_count());
+    }
+    stop = true;
+    writer.join();
+
+    for (int key = 0; key < 64; ++key) {
+        list.insert(key);
+    }
+    std::vector<int> expected(64);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(scan(list, 0, 64), expected);
+    EXPECT_EQ(list.size(), 64u);
+}
+
+TEST(ShardedSkipListTest, RangeScansCoverExactlyTheRange) {
+    sharded_skip_list<int, 16> list(64);
+    std::set<int> reference;
+    std::mt19937 g(11);
+    for (int i = 0; i < 3000; ++i) {
+        const int key = static_cast<int>(g() % 10000);
+        EXPECT_EQ(list.insert(key), reference.insert(key).second);
+    }
+    ASSERT_GT(list.shard_count(), 8u);
+
+    for (auto [lo, hi] : {std::pair{0, 10000}, std::pair{2500, 2600}, std::pair{-10, 3}, std::pair{7000, 7000},
+                          std::pair{9000, 20000}}) {
+        const std::vector<int> expected(reference.lower_bound(lo), reference.lower_bound(hi));
+        EXPECT_EQ(scan(list, lo, hi), expected) << lo << ' ' << hi;
+
+        std::vector<int> ordered;
+        list.for_each_range(lo, hi, [&](int key) { ordered.push_back(key); }, inline_executor{});
+        EXPECT_EQ(ordered, expected); // Inline tasks run shard after shard, in key order.
+    }
+}
+
+TEST(ShardedSkipListTest, ScanRethrowsTheFirstError) {
+    sharded_skip_list<int, 4> list(10);
+    for (int i = 0; i < 100; ++i) {
+        list.insert(i);
+    }
+    EXPECT_THROW(list.for_each_range(0, 100, [](int key) {
+        if (key == 42) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    int accepted = 0;
+    const auto failing_executor = [&accepted](auto task) {
+        if (accepted == 2) throw std::runtime_error("pool full");
+        ++accepted;
+        task();
+    };
+    EXPECT_THROW(list.for_each_range(0, 100, [](int) {}, failing_executor), std::runtime_error);
+}
+
+TEST(ShardedSkipListTest, ConcurrentUpdatesSplitsAndScans) {
+    constexpr int thread_count = 4;
+    constexpr int per_thread = 3000;
+    sharded_skip_list<int, 32> list(128);
+    std::atomic<bool> stop{false};
+
+    std::thread scanner([&] {
+        while (!stop.load()) {
+            std::atomic<int> previous_total{0};
+            list.for_each_range(0, thread_count * per_thread, [&](int) { previous_total.fetch_add(1); });
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < thread_count; ++t) {
+        writers.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                const int key = i * thread_count + t;
+                EXPECT_TRUE(list.insert(key));
+                if (i % 3 == 0) {
+                    EXPECT_TRUE(list.erase(key));
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop = true;
+    scanner.join();
+
+    std::vector<int> expected;
+    for (int i = 0; i < per_thread; ++i) {
+        for (int t = 0; t < thread_count; ++t) {
+            if (i % 3 != 0) {
+                expected.push_back(i * thread_count + t);
+            }
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(scan(list, 0, thread_count * per_thread), expected);
+    EXPECT_EQ(list.size(), expected.size());
+    EXPECT_GT(list.shard_count(), 1u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
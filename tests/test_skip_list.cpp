@@ -4,6 +4,23 @@
 #include <numeric>
 #include <algorithm>
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <cctype>
+#include <compare>
+#include <functional>
+#include <tuple>
+#include <memory>
+#include <random>
+#include <thread>
+#include <ranges>
+#include <span>
+#include <iterator>
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <bit>
+#include <utility>
 
 TEST(SkipListInitializationTest, DefaultConstructor) {
     skip_list<int> list;
@@ -164,6 +181,2087 @@ TEST(SkipListAdvancedOpsTest, ClearEmptyList) {
     EXPECT_EQ(list.size(), 0);
 }
 
+struct alignas(64) OverAlignedKey {
+    int id;
+
+    bool operator<(const OverAlignedKey& other) const { return id < other.id; }
+    bool operator==(const OverAlignedKey& other) const { return id == other.id; }
+    bool operator!=(const OverAlignedKey& other) const { return id != other.id; }
+};
+
+TEST(SkipListAdvancedOpsTest, OverAlignedKeysKeepTheirAlignment) {
+    skip_list<OverAlignedKey> list;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(list.insert(OverAlignedKey{i}));
+    }
+    for (const auto& key : list) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&key) % alignof(OverAlignedKey), 0u);
+    }
+    EXPECT_TRUE(list.contains(OverAlignedKey{42}));
+    EXPECT_TRUE(list.erase(OverAlignedKey{42}));
+    EXPECT_FALSE(list.contains(OverAlignedKey{42}));
+}
+
+struct AllocationStats {
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t live_bytes = 0;
+};
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    AllocationStats* stats;
+
+    explicit CountingAllocator(AllocationStats* s) : stats(s) {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : stats(other.stats) {}
+
+    T* allocate(std::size_t n) {
+        ++stats->allocations;
+        stats->live_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        ++stats->deallocations;
+        stats->live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>& other) const { return stats == other.stats; }
+    template<typename U>
+    bool operator!=(const CountingAllocator<U>& other) const { return stats != other.stats; }
+};
+
+TEST(SkipListAllocatorTest, NodesComeFromTheGivenAllocator) {
+    AllocationStats stats;
+    {
+        skip_list<int, std::less<int>, CountingAllocator<int>> list{CountingAllocator<int>(&stats)};
+        const std::size_t baseline = stats.allocations;
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(list.insert(i));
+        }
+        EXPECT_GT(stats.allocations, baseline);
+        EXPECT_LT(stats.allocations - baseline, 100u); // Served slab by slab, not node by node.
+        EXPECT_EQ(list.get_allocator().stats, &stats);
+    }
+    EXPECT_EQ(stats.allocations, stats.deallocations);
+    EXPECT_EQ(stats.live_bytes, 0u);
+}
+
+TEST(SkipListAllocatorTest, EmptyListAllocatesNothing) {
+    AllocationStats stats;
+    {
+        skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>> list{
+            CountingAllocator<std::string>(&stats)};
+        EXPECT_TRUE(list.empty());
+        EXPECT_FALSE(list.contains("missing"));
+        EXPECT_FALSE(list.erase("missing"));
+        list.clear();
+    }
+    EXPECT_EQ(stats.allocations, 0u);
+}
+
+TEST(SkipListAllocatorTest, ChurnReusesFreedNodes) {
+    AllocationStats stats;
+    skip_list<int, std::less<int>, CountingAllocator<int>> list{CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 500; ++i) {
+        list.insert(i);
+    }
+    const std::size_t after_fill = stats.allocations;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 500; ++i) {
+            ASSERT_TRUE(list.erase(i));
+        }
+        for (int i = 0; i < 500; ++i) {
+            ASSERT_TRUE(list.insert(i));
+        }
+    }
+    EXPECT_LE(stats.allocations - after_fill, 20u);
+    EXPECT_EQ(list.size(), 500u);
+}
+
+TEST(SkipListAllocatorTest, ClearReturnsAllNodeMemory) {
+    AllocationStats stats;
+    skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>> list{CountingAllocator<std::string>(&stats)};
+    const std::size_t empty_bytes = stats.live_bytes;
+    for (int i = 0; i < 300; ++i) {
+        list.insert(std::string(40, 'a') + std::to_string(i));
+    }
+    list.clear();
+    EXPECT_EQ(stats.live_bytes, empty_bytes);
+    EXPECT_TRUE(list.insert("reused"));
+    EXPECT_TRUE(list.contains("reused"));
+}
+
+TEST(SkipListCompareTest, CustomComparatorDefinesOrder) {
+    skip_list<int, std::greater<int>> list;
+    for (int val : {3, 1, 4, 5, 9, 2, 6}) {
+        list.insert(val);
+    }
+    std::vector<int> traversed(list.begin(), list.end());
+    EXPECT_EQ(traversed, (std::vector<int>{9, 6, 5, 4, 3, 2, 1}));
+    EXPECT_TRUE(list.contains(4));
+    EXPECT_TRUE(list.erase(9));
+    EXPECT_EQ(*list.begin(), 6);
+}
+
+struct CaseInsensitiveLess {
+    bool operator()(const std::string& a, const std::string& b) const {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) < std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+};
+
+TEST(SkipListCompareTest, EquivalenceIsDerivedFromComparator) {
+    skip_list<std::string, CaseInsensitiveLess> list;
+    EXPECT_TRUE(list.insert("Hello"));
+    EXPECT_FALSE(list.insert("HELLO"));
+    EXPECT_TRUE(list.contains("hello"));
+    ASSERT_NE(list.find("hElLo"), list.end());
+    EXPECT_EQ(*list.find("hElLo"), "Hello");
+    EXPECT_TRUE(list.erase("hello"));
+    EXPECT_TRUE(list.empty());
+}
+
+struct ThreeWayKey {
+    static inline int less_calls = 0;
+    static inline int three_way_calls = 0;
+
+    int id = 0;
+
+    friend bool operator<(const ThreeWayKey& a, const ThreeWayKey& b) {
+        ++less_calls;
+        return a.id < b.id;
+    }
+    friend std::strong_ordering operator<=>(const ThreeWayKey& a, const ThreeWayKey& b) {
+        ++three_way_calls;
+        return a.id <=> b.id;
+    }
+    friend bool operator==(const ThreeWayKey& a, const ThreeWayKey& b) { return a.id == b.id; }
+};
+
+TEST(SkipListCompareTest, ThreeWayComparableKeysUseOneComparisonPerStep) {
+    skip_list<ThreeWayKey> list;
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(list.insert(ThreeWayKey{(i * 37) % 200}));
+    }
+    EXPECT_FALSE(list.insert(ThreeWayKey{17}));
+    EXPECT_TRUE(list.contains(ThreeWayKey{42}));
+    EXPECT_FALSE(list.contains(ThreeWayKey{500}));
+    EXPECT_NE(list.find(ThreeWayKey{99}), list.end());
+    EXPECT_TRUE(list.erase(ThreeWayKey{99}));
+    EXPECT_FALSE(list.erase(ThreeWayKey{99}));
+    EXPECT_EQ(list.size(), 199u);
+
+    EXPECT_EQ(ThreeWayKey::less_calls, 0);
+    EXPECT_GT(ThreeWayKey::three_way_calls, 0);
+
+    int expected = 0;
+    for (const auto& key : list) {
+        if (expected == 99) ++expected;
+        EXPECT_EQ(key.id, expected++);
+    }
+}
+
+TEST(SkipListCompareTest, CompositeKeys) {
+    skip_list<std::tuple<int, std::string>> list;
+    list.insert({2, "b"});
+    list.insert({1, "z"});
+    list.insert({2, "a"});
+    EXPECT_FALSE(list.insert({1, "z"}));
+    EXPECT_TRUE(list.contains({2, "a"}));
+    EXPECT_FALSE(list.contains({2, "c"}));
+    std::vector<std::tuple<int, std::string>> traversed(list.begin(), list.end());
+    EXPECT_EQ(traversed, (std::vector<std::tuple<int, std::string>>{{1, "z"}, {2, "a"}, {2, "b"}}));
+}
+
+struct MoveOnlyKey {
+    static inline int constructions = 0;
+
+    int id = 0;
+    std::unique_ptr<std::string> payload;
+
+    MoveOnlyKey(int i, std::string text) : id(i), payload(std::make_unique<std::string>(std::move(text))) {
+        ++constructions;
+    }
+    MoveOnlyKey(MoveOnlyKey&&) noexcept = default;
+    MoveOnlyKey& operator=(MoveOnlyKey&&) noexcept = default;
+
+    friend bool operator<(const MoveOnlyKey& a, const MoveOnlyKey& b) { return a.id < b.id; }
+};
+
+struct MoveOnlyKeyLess {
+    using is_transparent = void;
+
+    bool operator()(const MoveOnlyKey& a, const MoveOnlyKey& b) const { return a.id < b.id; }
+    bool operator()(const MoveOnlyKey& a, int b) const { return a.id < b; }
+    bool operator()(int a, const MoveOnlyKey& b) const { return a < b.id; }
+};
+
+TEST(SkipListMoveTest, InsertMovesValueIntoNode) {
+    skip_list<std::unique_ptr<int>> list;
+    auto owned = std::make_unique<int>(7);
+    int* raw = owned.get();
+    EXPECT_TRUE(list.insert(std::move(owned)));
+    EXPECT_EQ(owned, nullptr);
+    ASSERT_EQ(list.size(), 1u);
+    EXPECT_EQ(list.begin()->get(), raw);
+}
+
+TEST(SkipListMoveTest, DuplicateInsertLeavesRvalueUntouched) {
+    skip_list<std::string> list;
+    std::string big(1000, 'k');
+    ASSERT_TRUE(list.insert(big));
+    EXPECT_FALSE(list.insert(std::move(big)));
+    EXPECT_EQ(big.size(), 1000u);
+}
+
+TEST(SkipListMoveTest, EmplaceConstructsInPlace) {
+    skip_list<MoveOnlyKey, MoveOnlyKeyLess> list;
+    auto [it, inserted] = list.emplace(3, "three");
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(it->id, 3);
+    EXPECT_EQ(*it->payload, "three");
+
+    auto [dup, dup_inserted] = list.emplace(3, "again");
+    EXPECT_FALSE(dup_inserted);
+    EXPECT_EQ(dup, it);
+    EXPECT_EQ(*dup->payload, "three");
+    EXPECT_EQ(list.size(), 1u);
+}
+
+TEST(SkipListMoveTest, EmplaceHintSkipsConstructionOfDuplicates) {
+    skip_list<MoveOnlyKey, MoveOnlyKeyLess> list;
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(list.emplace_hint(i, i, std::to_string(i)).second);
+    }
+
+    MoveOnlyKey::constructions = 0;
+    for (int i = 0; i < 50; ++i) {
+        auto [it, inserted] = list.emplace_hint(i, i, "unused");
+        EXPECT_FALSE(inserted);
+        EXPECT_EQ(*it->payload, std::to_string(i));
+    }
+    EXPECT_EQ(MoveOnlyKey::constructions, 0);
+
+    EXPECT_TRUE(list.emplace_hint(50, 50, "fifty").second);
+    EXPECT_EQ(MoveOnlyKey::constructions, 1);
+    EXPECT_TRUE(list.contains(50));
+}
+
+struct NoDefaultKey {
+    explicit NoDefaultKey(int i) : id(i) {}
+
+    int id;
+
+    auto operator<=>(const NoDefaultKey&) const = default;
+};
+
+TEST(SkipListAdvancedOpsTest, KeysNeedNotBeDefaultConstructible) {
+    static_assert(!std::is_default_constructible_v<NoDefaultKey>);
+    skip_list<NoDefaultKey> list;
+    EXPECT_TRUE(list.insert(NoDefaultKey(2)));
+    EXPECT_TRUE(list.insert(NoDefaultKey(1)));
+    EXPECT_TRUE(list.contains(NoDefaultKey(2)));
+    EXPECT_EQ(list.begin()->id, 1);
+    EXPECT_TRUE(list.erase(NoDefaultKey(1)));
+    EXPECT_EQ(list.size(), 1u);
+}
+
+struct FlatTraits : skip_list_traits {
+    static constexpr int max_height = 1;
+};
+
+struct SparseTraits : skip_list_traits {
+    static constexpr int max_height = 48;
+    static constexpr int promotion_shift = 2;
+};
+
+template<typename Traits>
+void ExpectSortedSetBehaviour() {
+    skip_list<int, std::less<int>, std::allocator<int>, Traits> list;
+    std::vector<int> values(500);
+    std::iota(values.begin(), values.end(), 0);
+    std::mt19937 g(7);
+    std::shuffle(values.begin(), values.end(), g);
+    for (int val : values) {
+        ASSERT_TRUE(list.insert(val));
+    }
+    for (int val : values) {
+        ASSERT_TRUE(list.contains(val));
+    }
+    std::vector<int> traversed(list.begin(), list.end());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(traversed, values);
+    for (int val = 0; val < 500; val += 2) {
+        ASSERT_TRUE(list.erase(val));
+    }
+    EXPECT_EQ(list.size(), 250u);
+    EXPECT_FALSE(list.contains(100));
+    EXPECT_TRUE(list.contains(101));
+}
+
+TEST(SkipListTraitsTest, SingleLevelListDegeneratesToLinkedList) {
+    ExpectSortedSetBehaviour<FlatTraits>();
+}
+
+TEST(SkipListTraitsTest, QuarterPromotionWithDeepTowers) {
+    ExpectSortedSetBehaviour<SparseTraits>();
+}
+
+TEST(SkipListLevelGeneratorTest, SameSeedGivesSameSequence) {
+    xorshift_level_generator a(1234), b(1234), c(4321);
+    bool differs = false;
+    for (int i = 0; i < 100; ++i) {
+        const auto x = a();
+        EXPECT_EQ(x, b());
+        differs |= (x != c());
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(SkipListLevelGeneratorTest, ZeroSeedStillProducesRandomBits) {
+    xorshift_level_generator gen(0);
+    const auto first = gen();
+    EXPECT_NE(first, 0u);
+    EXPECT_NE(first, gen());
+}
+
+TEST(SkipListLevelGeneratorTest, PromotionBitsAreBalanced) {
+    xorshift_level_generator gen;
+    int promoted = 0;
+    const int draws = 100000;
+    for (int i = 0; i < draws; ++i) {
+        promoted += (gen() & 1u) == 0;
+    }
+    EXPECT_NEAR(static_cast<double>(promoted) / draws, 0.5, 0.01);
+}
+
+TEST(SkipListLevelGeneratorTest, SeededListsBehaveIdentically) {
+    skip_list<int> a(std::uint64_t{99}), b(std::uint64_t{99});
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(a.insert((i * 7919) % 1000));
+        ASSERT_TRUE(b.insert((i * 7919) % 1000));
+    }
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+}
+
+TEST(SkipListLevelGeneratorTest, EmptyListsAreSmall) {
+    // The sentinel tower and the pool free lists, one per height, are nearly all of it.
+    EXPECT_LE(sizeof(skip_list<int>), 640u);
+}
+
+struct ThreadLocalTraits : skip_list_traits {
+    using level_generator = thread_local_level_generator;
+};
+
+TEST(SkipListLevelGeneratorTest, ThreadLocalGeneratorCarriesNoState) {
+    using shared_list = skip_list<int, std::less<int>, std::allocator<int>, ThreadLocalTraits>;
+    EXPECT_LT(sizeof(shared_list), sizeof(skip_list<int>));
+
+    std::vector<std::thread> workers;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([t, &failures] {
+            shared_list list;
+            for (int i = 0; i < 2000; ++i) {
+                failures[t] += !list.insert(i);
+            }
+            for (int i = 0; i < 2000; ++i) {
+                failures[t] += !list.contains(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(failures, std::vector<int>(4, 0));
+}
+
+TEST(SkipListBulkBuildTest, RangeConstructorFromSortedInput) {
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+    skip_list<int> list(values.begin(), values.end());
+    EXPECT_EQ(list.size(), values.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), values.begin(), values.end()));
+    for (int val : {0, 1, 4242, 9999}) {
+        EXPECT_TRUE(list.contains(val));
+    }
+    EXPECT_FALSE(list.contains(10000));
+    EXPECT_TRUE(list.erase(4242));
+    EXPECT_TRUE(list.insert(4242));
+}
+
+TEST(SkipListBulkBuildTest, RangeConstructorAcceptsUnsortedInputWithDuplicates) {
+    std::vector<int> values = {5, 3, 9, 3, 1, 9, 7, 2};
+    skip_list<int> list(values.begin(), values.end());
+    std::vector<int> traversed(list.begin(), list.end());
+    EXPECT_EQ(traversed, (std::vector<int>{1, 2, 3, 5, 7, 9}));
+}
+
+TEST(SkipListBulkBuildTest, InsertSortedAppendsBehindExistingElements) {
+    skip_list<int> list;
+    for (int val : {4, 1, 2}) {
+        list.insert(val);
+    }
+    std::vector<int> more = {5, 6, 8, 8, 10};
+    EXPECT_EQ(list.insert_sorted(more.begin(), more.end()), 4u);
+    std::vector<int> traversed(list.begin(), list.end());
+    EXPECT_EQ(traversed, (std::vector<int>{1, 2, 4, 5, 6, 8, 10}));
+    EXPECT_TRUE(list.insert(7));
+    EXPECT_TRUE(list.insert(11));
+    EXPECT_TRUE(list.contains(8));
+}
+
+TEST(SkipListBulkBuildTest, InsertSortedInterleavedWithExistingElements) {
+    skip_list<int> list;
+    for (int val = 0; val < 100; val += 10) {
+        list.insert(val);
+    }
+    std::vector<int> more;
+    for (int val = 5; val < 200; val += 5) {
+        more.push_back(val);
+    }
+    list.insert_sorted(more.begin(), more.end());
+    std::vector<int> expected;
+    for (int val = 0; val < 200; val += 5) {
+        expected.push_back(val);
+    }
+    std::vector<int> traversed(list.begin(), list.end());
+    EXPECT_EQ(traversed, expected);
+    for (int val : expected) {
+        ASSERT_TRUE(list.contains(val));
+    }
+}
+
+TEST(SkipListBulkBuildTest, BalancedHeightsBuildASearchableList) {
+    skip_list<std::string> list;
+    std::vector<std::string> words;
+    for (int i = 0; i < 1000; ++i) {
+        words.push_back("key" + std::string(6 - std::to_string(i).size(), '0') + std::to_string(i));
+    }
+    EXPECT_EQ(list.insert_sorted(words.begin(), words.end(), tower_heights::balanced), words.size());
+    for (const auto& word : words) {
+        ASSERT_TRUE(list.contains(word));
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), words.begin(), words.end()));
+    for (std::size_t i = 0; i < words.size(); i += 3) {
+        ASSERT_TRUE(list.erase(words[i]));
+    }
+    EXPECT_EQ(list.size(), 666u);
+}
+
+TEST(SkipListBulkBuildTest, RangeConstructorMovesFromMoveIterators) {
+    std::vector<std::unique_ptr<int>> owned;
+    for (int i = 0; i < 10; ++i) {
+        owned.push_back(std::make_unique<int>(i));
+    }
+    std::sort(owned.begin(), owned.end());
+    skip_list<std::unique_ptr<int>> list(std::make_move_iterator(owned.begin()), std::make_move_iterator(owned.end()));
+    EXPECT_EQ(list.size(), 10u);
+    EXPECT_TRUE(std::all_of(owned.begin(), owned.end(), [](const auto& p) { return p == nullptr; }));
+}
+
+class SkipListRangeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int val = 10; val <= 100; val += 10) {
+            list.insert(val);
+        }
+    }
+
+    std::vector<int> contents() const { return std::vector<int>(list.begin(), list.end()); }
+
+    skip_list<int> list;
+};
+
+TEST_F(SkipListRangeTest, LowerBound) {
+    EXPECT_EQ(*list.lower_bound(30), 30);
+    EXPECT_EQ(*list.lower_bound(31), 40);
+    EXPECT_EQ(*list.lower_bound(-5), 10);
+    EXPECT_EQ(list.lower_bound(101), list.end());
+}
+
+TEST_F(SkipListRangeTest, UpperBound) {
+    EXPECT_EQ(*list.upper_bound(30), 40);
+    EXPECT_EQ(*list.upper_bound(29), 30);
+    EXPECT_EQ(*list.upper_bound(-5), 10);
+    EXPECT_EQ(list.upper_bound(100), list.end());
+}
+
+TEST_F(SkipListRangeTest, EqualRange) {
+    auto [first, last] = list.equal_range(50);
+    ASSERT_NE(first, list.end());
+    EXPECT_EQ(*first, 50);
+    EXPECT_EQ(*last, 60);
+    EXPECT_EQ(std::distance(first, last), 1);
+
+    auto [missing_first, missing_last] = list.equal_range(55);
+    EXPECT_EQ(missing_first, missing_last);
+    EXPECT_EQ(*missing_first, 60);
+}
+
+TEST_F(SkipListRangeTest, WindowScan) {
+    std::vector<int> window(list.lower_bound(25), list.upper_bound(70));
+    EXPECT_EQ(window, (std::vector<int>{30, 40, 50, 60, 70}));
+}
+
+TEST_F(SkipListRangeTest, EraseIteratorRange) {
+    auto last = list.erase(list.lower_bound(30), list.lower_bound(70));
+    EXPECT_EQ(*last, 70);
+    EXPECT_EQ(contents(), (std::vector<int>{10, 20, 70, 80, 90, 100}));
+    EXPECT_EQ(list.size(), 6u);
+    EXPECT_FALSE(list.contains(50));
+    EXPECT_TRUE(list.insert(50));
+    EXPECT_TRUE(list.contains(70));
+}
+
+TEST_F(SkipListRangeTest, EraseEverythingThroughIterators) {
+    EXPECT_EQ(list.erase(list.begin(), list.end()), list.end());
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_EQ(contents(), (std::vector<int>{1}));
+}
+
+TEST_F(SkipListRangeTest, EraseEmptyIteratorRange) {
+    auto it = list.find(40);
+    EXPECT_EQ(list.erase(it, it), it);
+    EXPECT_EQ(list.size(), 10u);
+}
+
+TEST_F(SkipListRangeTest, EraseKeyRange) {
+    EXPECT_EQ(list.erase_range(15, 45), 3u);
+    EXPECT_EQ(contents(), (std::vector<int>{10, 50, 60, 70, 80, 90, 100}));
+    EXPECT_EQ(list.erase_range(0, 11), 1u);
+    EXPECT_EQ(list.erase_range(95, 1000), 1u);
+    EXPECT_EQ(list.erase_range(60, 60), 0u);
+    EXPECT_EQ(list.erase_range(80, 60), 0u);
+    EXPECT_EQ(contents(), (std::vector<int>{50, 60, 70, 80, 90}));
+    EXPECT_EQ(list.size(), 5u);
+}
+
+TEST(SkipListRangeEraseTest, ExpireLargeSpans) {
+    skip_list<int> list;
+    for (int i = 0; i < 10000; ++i) {
+        list.insert((i * 7919) % 10000);
+    }
+    EXPECT_EQ(list.erase_range(1000, 9000), 8000u);
+    EXPECT_EQ(list.size(), 2000u);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(list.contains(i), i < 1000 || i >= 9000) << i;
+    }
+    for (int i = 1000; i < 9000; ++i) {
+        ASSERT_TRUE(list.insert(i));
+    }
+    EXPECT_EQ(list.size(), 10000u);
+}
+
+TEST(SkipListRangeEraseTest, HeterogeneousBounds) {
+    skip_list<std::string, std::less<>> list;
+    for (const char* word : {"apple", "banana", "cherry", "date"}) {
+        list.insert(word);
+    }
+    EXPECT_EQ(*list.lower_bound(std::string_view("b")), "banana");
+    EXPECT_EQ(*list.upper_bound(std::string_view("banana")), "cherry");
+    EXPECT_EQ(list.erase_range(std::string_view("b"), std::string_view("d")), 2u);
+    EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"apple", "date"}));
+}
+
+TEST(SkipListFingerTest, AscendingInsertsThroughFinger) {
+    skip_list<int> list;
+    skip_list<int>::finger hint;
+    for (int i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(list.insert(hint, i));
+    }
+    EXPECT_FALSE(list.insert(hint, 1999));
+    EXPECT_FALSE(list.insert(hint, 0));
+    EXPECT_EQ(list.size(), 2000u);
+    std::vector<int> expected(2000);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), expected);
+}
+
+TEST(SkipListFingerTest, NearlySortedInsertsThroughFinger) {
+    skip_list<int> list;
+    skip_list<int>::finger hint;
+    std::mt19937 g(3);
+    std::vector<int> values;
+    for (int i = 0; i < 3000; ++i) {
+        values.push_back(i * 2 + static_cast<int>(g() % 20)); // Small backwards jumps and duplicates.
+    }
+    for (int val : values) {
+        list.insert(hint, val);
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    EXPECT_EQ(list.size(), values.size());
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), values);
+}
+
+TEST(SkipListFingerTest, FindThroughFinger) {
+    skip_list<int> list;
+    for (int i = 0; i < 1000; i += 2) {
+        list.insert(i);
+    }
+    skip_list<int>::finger hint;
+    for (int i = 0; i < 1000; ++i) {
+        auto it = list.find(hint, i);
+        if (i % 2 == 0) {
+            ASSERT_NE(it, list.end());
+            EXPECT_EQ(*it, i);
+        } else {
+            EXPECT_EQ(it, list.end());
+        }
+    }
+    for (int i = 999; i >= 0; i -= 7) {
+        EXPECT_EQ(list.find(hint, i) != list.end(), i % 2 == 0) << i;
+    }
+}
+
+TEST(SkipListFingerTest, StaleFingerFallsBackToFullSearch) {
+    skip_list<int> list;
+    skip_list<int>::finger hint;
+    for (int i = 0; i < 100; ++i) {
+        list.insert(hint, i);
+    }
+    EXPECT_EQ(*list.find(hint, 50), 50);
+
+    // Erasing the finger's predecessors must not leave it pointing at freed nodes.
+    EXPECT_EQ(list.erase_range(10, 90), 80u);
+    EXPECT_EQ(list.find(hint, 50), list.end());
+    EXPECT_EQ(*list.find(hint, 95), 95);
+    list.clear();
+    EXPECT_EQ(list.find(hint, 95), list.end());
+    EXPECT_TRUE(list.insert(hint, 5));
+
+    skip_list<int> other;
+    other.insert(5);
+    EXPECT_EQ(*other.find(hint, 5), 5);
+}
+
+TEST(SkipListFingerTest, HeterogeneousFindThroughFinger) {
+    skip_list<std::string, std::less<>> list;
+    skip_list<std::string, std::less<>>::finger hint;
+    for (const char* word : {"apple", "banana", "cherry"}) {
+        list.insert(hint, word);
+    }
+    EXPECT_EQ(*list.find(hint, std::string_view("banana")), "banana");
+    EXPECT_EQ(list.find(hint, std::string_view("blueberry")), list.end());
+}
+
+struct LastAccessTraits : skip_list_traits {
+    static constexpr bool last_access_finger = true;
+};
+
+TEST(SkipListFingerTest, LastAccessFingerKeepsSetSemantics) {
+    ExpectSortedSetBehaviour<LastAccessTraits>();
+
+    skip_list<int, std::less<int>, std::allocator<int>, LastAccessTraits> list;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(list.insert(i));
+    }
+    for (int i = 999; i >= 0; i -= 3) {
+        ASSERT_TRUE(list.erase(i));
+        ASSERT_FALSE(list.erase(i));
+    }
+    EXPECT_EQ(list.erase_range(100, 200), 67u);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(list.contains(i), (999 - i) % 3 != 0 && (i < 100 || i >= 200)) << i;
+    }
+    EXPECT_TRUE(list.emplace(999).second);
+    EXPECT_FALSE(list.emplace(999).second);
+}
+
+struct IndexedTraits : skip_list_traits {
+    static constexpr bool indexed = true;
+};
+
+using indexed_list = skip_list<int, std::less<int>, std::allocator<int>, IndexedTraits>;
+
+/// Checks rank(), nth(), at() and advance() of every position against a sorted reference.
+void ExpectIndexMatches(const indexed_list& list, const std::vector<int>& expected) {
+    ASSERT_EQ(list.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(list.rank(expected[i]), i);
+        ASSERT_EQ(*list.nth(i), expected[i]);
+        ASSERT_EQ(list.at(i), expected[i]);
+    }
+    EXPECT_EQ(list.nth(expected.size()), list.end());
+    EXPECT_THROW(list.at(expected.size()), std::out_of_range);
+    for (std::size_t step : {1u, 3u, 17u, 250u}) {
+        std::size_t position = 0;
+        for (auto it = list.begin(); it != list.end(); it = list.advance(it, step), position += step) {
+            ASSERT_EQ(*it, expected[position]);
+        }
+        EXPECT_GE(position, expected.size());
+    }
+}
+
+TEST(SkipListIndexedTest, RankAndSelectAfterRandomInserts) {
+    indexed_list list;
+    std::vector<int> values(2000);
+    std::iota(values.begin(), values.end(), 0);
+    std::mt19937 g(11);
+    std::shuffle(values.begin(), values.end(), g);
+    for (int val : values) {
+        list.insert(val * 2);
+    }
+    std::vector<int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        expected.push_back(i * 2);
+    }
+    ExpectIndexMatches(list, expected);
+    EXPECT_EQ(list.rank(-5), 0u);
+    EXPECT_EQ(list.rank(7), 4u);
+    EXPECT_EQ(list.rank(100000), 2000u);
+}
+
+TEST(SkipListIndexedTest, SpansSurviveEveryKindOfErase) {
+    indexed_list list;
+    std::vector<int> expected;
+    for (int i = 0; i < 3000; ++i) {
+        list.insert(i);
+        expected.push_back(i);
+    }
+    for (int i = 0; i < 3000; i += 5) {
+        ASSERT_TRUE(list.erase(i));
+    }
+    EXPECT_EQ(list.erase_range(1000, 1500), 400u);
+    list.erase(list.nth(100), list.nth(200));
+    std::erase_if(expected, [](int v) { return v % 5 == 0 || (v >= 1000 && v < 1500); });
+    expected.erase(expected.begin() + 100, expected.begin() + 200);
+    ExpectIndexMatches(list, expected);
+
+    list.clear();
+    ExpectIndexMatches(list, {});
+}
+
+TEST(SkipListIndexedTest, SpansSurviveBulkAndFingerInserts) {
+    std::vector<int> sorted(1500);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    indexed_list list(sorted.begin(), sorted.end());
+    ExpectIndexMatches(list, sorted);
+
+    const std::vector<int> more = {-3, 700, 1499, 1500, 1600, 1700};
+    list.insert_sorted(more.begin(), more.end());
+    indexed_list::finger hint;
+    for (int i = 1800; i < 2000; ++i) {
+        list.insert(hint, i);
+    }
+
+    std::vector<int> expected = sorted;
+    expected.insert(expected.begin(), -3);
+    for (int val : {1500, 1600, 1700}) {
+        expected.push_back(val);
+    }
+    for (int i = 1800; i < 2000; ++i) {
+        expected.push_back(i);
+    }
+    ExpectIndexMatches(list, expected);
+}
+
+TEST(SkipListIndexedTest, PercentileOfLiveSet) {
+    indexed_list list;
+    for (int i = 1; i <= 1000; ++i) {
+        list.insert(i * 10);
+    }
+    EXPECT_EQ(*list.nth(list.size() / 2), 5010);
+    EXPECT_EQ(*list.nth(list.size() * 99 / 100), 9910);
+    EXPECT_EQ(*list.advance(list.find(100), 10), 200);
+    EXPECT_EQ(list.advance(list.find(9990), 5), list.end());
+}
+
+struct BidirectionalTraits : skip_list_traits {
+    static constexpr bool bidirectional = true;
+};
+
+using bidirectional_list = skip_list<int, std::less<int>, std::allocator<int>, BidirectionalTraits>;
+
+/// Walks the list backwards from end() and checks it mirrors the forward order.
+template<typename List>
+void ExpectReverseMatches(const List& list) {
+    std::vector<int> forward(list.begin(), list.end());
+    std::vector<int> backward(list.rbegin(), list.rend());
+    std::reverse(backward.begin(), backward.end());
+    ASSERT_EQ(backward, forward);
+    if (!forward.empty()) {
+        EXPECT_EQ(list.front(), forward.front());
+        EXPECT_EQ(list.back(), forward.back());
+        EXPECT_EQ(*std::prev(list.end()), forward.back());
+    }
+}
+
+TEST(SkipListBidirectionalTest, IteratorCategory) {
+    static_assert(std::bidirectional_iterator<bidirectional_list::iterator>);
+    static_assert(!std::bidirectional_iterator<skip_list<int>::iterator>);
+    EXPECT_EQ(sizeof(skip_list<int>::iterator), sizeof(void*));
+}
+
+TEST(SkipListBidirectionalTest, ReverseTraversalAfterMixedUpdates) {
+    bidirectional_list list;
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::mt19937 g(5);
+    std::shuffle(values.begin(), values.end(), g);
+    for (int val : values) {
+        list.insert(val);
+    }
+    ExpectReverseMatches(list);
+
+    for (int i = 0; i < 1000; i += 3) {
+        list.erase(i);
+    }
+    list.erase_range(400, 600);
+    list.erase(list.find(700), list.end());
+    ExpectReverseMatches(list);
+    EXPECT_EQ(list.back(), 698);
+
+    const std::vector<int> appended = {800, 900, 1000};
+    list.insert_sorted(appended.begin(), appended.end());
+    ExpectReverseMatches(list);
+    EXPECT_EQ(list.back(), 1000);
+
+    auto it = list.find(800);
+    EXPECT_EQ(*--it, 698);
+    EXPECT_EQ(*it--, 698);
+    EXPECT_EQ(*it, 697);
+}
+
+TEST(SkipListBidirectionalTest, OrderedDequeOperations) {
+    bidirectional_list list;
+    for (int i = 0; i < 2000; ++i) {
+        list.insert(i);
+    }
+    int low = 0;
+    int high = 1999;
+    while (!list.empty()) {
+        ASSERT_EQ(list.front(), low);
+        ASSERT_EQ(list.back(), high);
+        if ((low + high) % 3 == 0) {
+            list.pop_front();
+            ++low;
+        } else {
+            list.pop_back();
+            --high;
+        }
+        ASSERT_EQ(list.size(), static_cast<std::size_t>(high - low + 1));
+        if (low % 250 == 0) {
+            ExpectReverseMatches(list);
+        }
+    }
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_TRUE(list.insert(42));
+    EXPECT_EQ(list.back(), 42);
+    EXPECT_FALSE(list.contains(0));
+}
+
+TEST(SkipListBidirectionalTest, PopFrontWithoutBackwardLinks) {
+    skip_list<int> list;
+    for (int i = 0; i < 100; ++i) {
+        list.insert(i);
+    }
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_EQ(list.front(), i);
+        list.pop_front();
+    }
+    EXPECT_EQ(list.size(), 50u);
+    EXPECT_FALSE(list.contains(49));
+    EXPECT_TRUE(list.contains(50));
+}
+
+struct IndexedBidirectionalTraits : skip_list_traits {
+    static constexpr bool indexed = true;
+    static constexpr bool bidirectional = true;
+};
+
+TEST(SkipListBidirectionalTest, PopsKeepSpansConsistent) {
+    skip_list<int, std::less<int>, std::allocator<int>, IndexedBidirectionalTraits> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.insert(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        list.pop_back();
+        list.pop_front();
+    }
+    list.insert(5000);
+    list.insert(-5000);
+    ASSERT_EQ(list.size(), 802u);
+    EXPECT_EQ(list.at(0), -5000);
+    EXPECT_EQ(list.at(801), 5000);
+    for (int i = 100; i < 900; ++i) {
+        ASSERT_EQ(list.rank(i), static_cast<std::size_t>(i - 99));
+        ASSERT_EQ(list.at(static_cast<std::size_t>(i - 99)), i);
+    }
+    ExpectReverseMatches(list);
+}
+
+TEST(SkipListRangesTest, IteratorsModelTheStandardConcepts) {
+    using list_type = skip_list<int>;
+    static_assert(std::forward_iterator<list_type::iterator>);
+    static_assert(std::forward_iterator<list_type::const_iterator>);
+    static_assert(std::ranges::forward_range<list_type>);
+    static_assert(std::ranges::forward_range<const list_type>);
+    static_assert(std::ranges::common_range<list_type>);
+    static_assert(std::sentinel_for<std::default_sentinel_t, list_type::iterator>);
+    static_assert(std::bidirectional_iterator<bidirectional_list::const_iterator>);
+
+    // The elements of a set are its keys, so no iterator hands out a mutable reference.
+    static_assert(std::is_same_v<std::iter_reference_t<list_type::iterator>, const int&>);
+    static_assert(std::is_same_v<decltype(*std::declval<const list_type&>().find(1)), const int&>);
+    static_assert(!std::is_assignable_v<decltype(*std::declval<list_type&>().begin()), int>);
+}
+
+TEST(SkipListRangesTest, ViewsComposeWithoutCopies) {
+    AllocationStats stats;
+    skip_list<int, std::less<int>, CountingAllocator<int>> list{CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 100; ++i) {
+        list.insert(i);
+    }
+    const std::size_t allocations = stats.allocations;
+
+    auto odd_squares = list | std::views::filter([](int v) { return v % 2 == 1; })
+                            | std::views::transform([](int v) { return v * v; })
+                            | std::views::take(3);
+    int sum = 0;
+    for (int v : odd_squares) {
+        sum += v;
+    }
+    EXPECT_EQ(sum, 1 + 9 + 25);
+
+    const auto& view = list;
+    EXPECT_EQ(std::ranges::distance(view), 100);
+    EXPECT_EQ(*std::ranges::find(view, 42), 42);
+    EXPECT_TRUE(std::ranges::is_sorted(view));
+    EXPECT_EQ(std::ranges::distance(std::ranges::subrange(view.find(90), std::default_sentinel)), 10);
+    EXPECT_EQ(*std::ranges::begin(view | std::views::drop(10)), 10);
+    EXPECT_EQ(stats.allocations, allocations);
+}
+
+TEST(SkipListBatchLookupTest, MatchesSingleLookups) {
+    // Large enough for the interleaved descents, which small lists skip.
+    const int limit = 450000;
+    skip_list<int> list;
+    for (int i = 0; i < limit; i += 3) {
+        list.insert(i);
+    }
+    std::vector<int> probes(4000);
+    std::mt19937 g(9);
+    for (int& probe : probes) {
+        probe = static_cast<int>(g() % (limit + 1000)) - 500;
+    }
+
+    std::unique_ptr<bool[]> found(new bool[probes.size()]);
+    list.contains_batch(probes, std::span<bool>(found.get(), probes.size()));
+    std::vector<skip_list<int>::const_iterator> iterators(probes.size());
+    list.find_batch(probes, iterators);
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        ASSERT_EQ(found[i], list.contains(probes[i])) << probes[i];
+        ASSERT_EQ(iterators[i], list.find(probes[i])) << probes[i];
+    }
+
+    // Sparse sorted probes still run interleaved.
+    std::sort(probes.begin(), probes.end());
+    list.contains_batch(probes, std::span<bool>(found.get(), probes.size()));
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        ASSERT_EQ(found[i], probes[i] >= 0 && probes[i] < limit && probes[i] % 3 == 0) << probes[i];
+    }
+
+    // Dense sorted probes take the finger sweep.
+    probes.resize(2000);
+    std::iota(probes.begin(), probes.end(), 70000);
+    list.contains_batch(probes, std::span<bool>(found.get(), probes.size()));
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        ASSERT_EQ(found[i], probes[i] % 3 == 0) << probes[i];
+    }
+}
+
+TEST(SkipListBatchLookupTest, EdgeCases) {
+    skip_list<int> list;
+    std::vector<int> probes = {3, 1, 2};
+    bool found[3] = {true, true, true};
+    list.contains_batch(probes, found);
+    EXPECT_FALSE(found[0] || found[1] || found[2]);
+
+    list.insert(2);
+    list.contains_batch({}, {});
+    list.contains_batch(probes, found);
+    EXPECT_FALSE(found[0]);
+    EXPECT_FALSE(found[1]);
+    EXPECT_TRUE(found[2]);
+    EXPECT_THROW(list.contains_batch(probes, std::span<bool>(found, 2)), std::invalid_argument);
+}
+
+TEST(SkipListBatchLookupTest, HeterogeneousProbes) {
+    skip_list<std::string, std::less<>> list;
+    for (const char* word : {"apple", "banana", "cherry"}) {
+        list.insert(word);
+    }
+    const std::vector<std::string_view> probes = {"cherry", "apple", "kiwi"};
+    std::vector<skip_list<std::string, std::less<>>::iterator> results(probes.size());
+    list.find_batch(std::span<const std::string_view>(probes), std::span(results));
+    EXPECT_EQ(*results[0], "cherry");
+    EXPECT_EQ(*results[1], "apple");
+    EXPECT_EQ(results[2], list.end());
+}
+
+TEST(SkipListBatchUpdateTest, InsertBatchReportsFlagsInInputOrder) {
+    skip_list<int> list;
+    for (int i = 0; i < 1000; i += 2) {
+        list.insert(i);
+    }
+    const std::vector<int> batch = {7, 4, 1500, 7, -3, 999, 4, 8};
+    bool inserted[8] = {};
+    EXPECT_EQ(list.insert_batch(batch, inserted), 4u);
+    const bool expected[8] = {true, false, true, false, true, true, false, false};
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(inserted[i], expected[i]) << i;
+    }
+    EXPECT_EQ(list.size(), 504u);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    for (int val : {7, 1500, -3, 999}) {
+        EXPECT_TRUE(list.contains(val));
+    }
+    EXPECT_THROW(list.insert_batch(batch, std::span<bool>(inserted, 3)), std::invalid_argument);
+}
+
+TEST(SkipListBatchUpdateTest, BatchesMatchSingleOperations) {
+    skip_list<int> batched;
+    skip_list<int> reference;
+    std::mt19937 g(21);
+    for (int round = 0; round < 20; ++round) {
+        std::vector<int> batch(1000);
+        for (int& key : batch) {
+            key = static_cast<int>(g() % 50000);
+        }
+        if (round % 4 == 0) {
+            std::sort(batch.begin(), batch.end()); // Exercise the in-place path as well.
+        }
+        std::unique_ptr<bool[]> flags(new bool[batch.size()]);
+        if (round % 3 == 2) {
+            batched.erase_batch(batch, std::span<bool>(flags.get(), batch.size()));
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                ASSERT_EQ(flags[i], reference.erase(batch[i])) << batch[i];
+            }
+        } else {
+            batched.insert_batch(batch, std::span<bool>(flags.get(), batch.size()));
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                ASSERT_EQ(flags[i], reference.insert(batch[i])) << batch[i];
+            }
+        }
+        ASSERT_EQ(batched.size(), reference.size());
+    }
+    EXPECT_TRUE(std::equal(batched.begin(), batched.end(), reference.begin(), reference.end()));
+}
+
+TEST(SkipListBatchUpdateTest, BatchesKeepIndexAndBackwardLinks) {
+    skip_list<int, std::less<int>, std::allocator<int>, IndexedBidirectionalTraits> list;
+    const std::vector<int> batch = {50, 10, 40, 20, 30};
+    EXPECT_EQ(list.insert_batch(batch), 5u);
+    const std::vector<int> doomed = {40, 10, 99};
+    EXPECT_EQ(list.erase_batch(doomed), 2u);
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), (std::vector<int>{50, 30, 20}));
+    EXPECT_EQ(list.rank(30), 1u);
+    EXPECT_EQ(list.at(2), 50);
+}
+
+TEST(SkipListBatchUpdateTest, HeterogeneousEraseBatch) {
+    skip_list<std::string, std::less<>> list;
+    for (const char* word : {"apple", "banana", "cherry", "date"}) {
+        list.insert(word);
+    }
+    const std::vector<std::string_view> doomed = {"date", "apple", "kiwi"};
+    EXPECT_EQ(list.erase_batch(std::span<const std::string_view>(doomed)), 2u);
+    EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"banana", "cherry"}));
+}
+
+struct ConcurrentReaderTraits : skip_list_traits {
+    static constexpr bool concurrent_readers = true;
+};
+
+using rcu_list = skip_list<int, std::less<int>, std::allocator<int>, ConcurrentReaderTraits>;
+
+TEST(SkipListConcurrentReadersTest, SingleThreadedBehaviourIsUnchanged) {
+    rcu_list list;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(list.insert(i));
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        EXPECT_TRUE(list.erase(i));
+    }
+    EXPECT_EQ(list.size(), 500u);
+    EXPECT_FALSE(list.contains(10));
+    EXPECT_TRUE(list.contains(11));
+    EXPECT_EQ(list.erase_range(100, 200), 50u);
+    list.pop_front();
+    EXPECT_EQ(list.front(), 3);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_TRUE(list.insert(5));
+    EXPECT_EQ(*list.begin(), 5);
+}
+
+TEST(SkipListConcurrentReadersTest, ErasedNodesOutliveOpenReadSections) {
+    rcu_list list;
+    for (int i = 0; i < 10; ++i) {
+        list.insert(i);
+    }
+    auto section = list.read_lock();
+    auto it = list.find(4);
+    ASSERT_NE(it, list.end());
+
+    // The writer erases from another thread while the section is open (ASan flags any early free).
+    std::thread writer([&] {
+        for (int i = 0; i < 10; ++i) {
+            list.erase(i);
+        }
+        for (int i = 100; i < 1000; ++i) {
+            list.insert(i);
+            list.erase(i);
+        }
+    });
+    writer.join();
+
+    EXPECT_EQ(*it, 4);
+    ++it;
+    EXPECT_EQ(*it, 5);
+    EXPECT_FALSE(list.contains(4));
+}
+
+TEST(SkipListConcurrentReadersTest, ReadersRunAlongsideOneWriter) {
+    constexpr int key_range = 4096;
+    rcu_list list;
+    for (int key = 0; key < key_range; key += 2) {
+        list.insert(key); // Even keys are never erased.
+    }
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&, t] {
+            std::mt19937 g(static_cast<unsigned>(t));
+            while (!stop.load(std::memory_order_relaxed)) {
+                const int key = static_cast<int>(g() % key_range) & ~1;
+                failures += !list.contains(key);
+
+                auto section = list.read_lock();
+                int previous = -1;
+                int evens = 0;
+                for (auto it = list.lower_bound(key_range / 2); it != list.end(); ++it) {
+                    failures += *it <= previous;
+                    previous = *it;
+                    evens += *it % 2 == 0;
+                }
+                failures += evens != key_range / 4;
+            }
+        });
+    }
+
+    std::mt19937 g(99);
+    for (int round = 0; round < 20000; ++round) {
+        const int key = static_cast<int>(g() % key_range) | 1;
+        list.insert(key);
+        list.erase(key | 1);
+        if (round % 5000 == 0) {
+            list.erase_range(1, 2); // Exercise span removal too.
+        }
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+}
+
+TEST(SkipListConcurrentReadersTest, BatchReadersRunAlongsideOneWriter) {
+    constexpr int key_range = 1 << 19; // Large enough for the interleaved lanes.
+    rcu_list list;
+    for (int key = 0; key < key_range; key += 2) {
+        list.insert(key); // Even keys are never erased.
+    }
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&, t] {
+            std::mt19937 g(static_cast<unsigned>(t));
+            std::vector<int> scattered(64);
+            std::vector<int> sorted(8192);
+            std::unique_ptr<bool[]> found(new bool[sorted.size()]);
+            std::vector<rcu_list::const_iterator> positions(scattered.size());
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int& key : scattered) {
+                    key = static_cast<int>(g() % key_range) & ~1;
+                }
+                list.contains_batch(scattered, std::span<bool>(found.get(), scattered.size()));
+                failures += static_cast<int>(std::count(found.get(), found.get() + scattered.size(), false));
+
+                const int first = static_cast<int>(g() % (key_range / 2)) & ~1;
+                for (std::size_t i = 0; i < sorted.size(); ++i) {
+                    sorted[i] = first + static_cast<int>(i); // Odd keys come and go.
+                }
+                list.contains_batch(sorted, std::span<bool>(found.get(), sorted.size()));
+                for (std::size_t i = 0; i < sorted.size(); i += 2) {
+                    failures += !found[i];
+                }
+
+                auto section = list.read_lock();
+                std::as_const(list).find_batch(scattered, positions);
+                for (std::size_t i = 0; i < scattered.size(); ++i) {
+                    failures += positions[i] == list.end() || *positions[i] != scattered[i];
+                }
+            }
+        });
+    }
+
+    std::mt19937 g(99);
+    for (int round = 0; round < 50000; ++round) {
+        const int key = static_cast<int>(g() % key_range) | 1;
+        list.insert(key);
+        list.erase(key);
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+}
+
+TEST(SkipListCopyMoveTest, CopyIsIndependentOfTheSource) {
+    indexed_list source;
+    std::vector<int> expected;
+    for (int i = 0; i < 2000; i += 2) {
+        source.insert(i);
+        expected.push_back(i);
+    }
+    indexed_list copy(source);
+    ExpectIndexMatches(copy, expected);
+
+    copy.insert(1);
+    source.erase(0);
+    EXPECT_TRUE(copy.contains(0));
+    EXPECT_FALSE(source.contains(1));
+
+    expected.erase(expected.begin());
+    copy = source;
+    ExpectIndexMatches(copy, expected);
+    const indexed_list& alias = copy;
+    copy = alias;
+    ExpectIndexMatches(copy, expected);
+}
+
+TEST(SkipListCopyMoveTest, CopyKeepsBackwardLinksAndAllocator) {
+    AllocationStats stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>,
+                                BidirectionalTraits>;
+    list_type source{CountingAllocator<std::string>(&stats)};
+    for (int i = 0; i < 300; ++i) {
+        source.insert(std::to_string(i));
+    }
+    list_type copy(source);
+    EXPECT_EQ(copy.get_allocator().stats, &stats);
+    EXPECT_TRUE(std::equal(source.begin(), source.end(), copy.begin(), copy.end()));
+    copy.pop_back();
+    copy.insert("a");
+    std::vector<std::string> forward(copy.begin(), copy.end());
+    std::vector<std::string> backward(copy.rbegin(), copy.rend());
+    std::reverse(backward.begin(), backward.end());
+    EXPECT_EQ(forward, backward);
+}
+
+TEST(SkipListCopyMoveTest, MoveTakesOverTheNodes) {
+    static_assert(std::is_nothrow_move_constructible_v<skip_list<int>>);
+    static_assert(std::is_nothrow_move_assignable_v<skip_list<int>>);
+
+    AllocationStats stats;
+    using list_type = skip_list<int, std::less<int>, CountingAllocator<int>>;
+    list_type source{CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 1000; ++i) {
+        source.insert(i);
+    }
+    const std::size_t allocations = stats.allocations;
+    list_type moved(std::move(source));
+    EXPECT_EQ(stats.allocations, allocations);
+    EXPECT_EQ(moved.size(), 1000u);
+    EXPECT_TRUE(moved.contains(999));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(source.begin(), source.end());
+    EXPECT_TRUE(source.insert(5)); // A moved-from list stays usable.
+
+    list_type target{CountingAllocator<int>(&stats)};
+    target.insert(-1);
+    const std::size_t before_assignment = stats.allocations;
+    target = std::move(moved);
+    EXPECT_EQ(stats.allocations, before_assignment);
+    EXPECT_EQ(target.size(), 1000u);
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_TRUE(moved.empty());
+
+    std::vector<skip_list<int>> lists;
+    for (int n = 0; n < 20; ++n) {
+        skip_list<int> list;
+        for (int i = 0; i < n; ++i) {
+            list.insert(i);
+        }
+        lists.push_back(std::move(list));
+    }
+    for (int n = 0; n < 20; ++n) {
+        ASSERT_EQ(lists[n].size(), static_cast<std::size_t>(n));
+    }
+}
+
+TEST(SkipListCopyMoveTest, MoveAssignmentAcrossUnequalAllocatorsMovesTheElements) {
+    AllocationStats first_stats;
+    AllocationStats second_stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type first{CountingAllocator<std::string>(&first_stats)};
+    list_type second{CountingAllocator<std::string>(&second_stats)};
+    for (int i = 0; i < 200; ++i) {
+        first.insert(std::string(30, 'x') + std::to_string(i));
+    }
+    second = std::move(first);
+    EXPECT_EQ(second.get_allocator().stats, &second_stats);
+    EXPECT_EQ(second.size(), 200u);
+    EXPECT_TRUE(second.contains(std::string(30, 'x') + "150"));
+    EXPECT_TRUE(first.empty());
+    EXPECT_GT(second_stats.live_bytes, 0u);
+}
+
+TEST(SkipListCopyMoveTest, SwapExchangesContents) {
+    bidirectional_list a;
+    bidirectional_list b;
+    for (int i = 0; i < 100; ++i) {
+        a.insert(i);
+    }
+    b.insert(-1);
+    bidirectional_list::finger hint;
+    a.insert(hint, 100);
+
+    swap(a, b);
+    EXPECT_EQ(a.size(), 1u);
+    EXPECT_EQ(b.size(), 101u);
+    ExpectReverseMatches(a);
+    ExpectReverseMatches(b);
+
+    EXPECT_TRUE(a.insert(hint, 101)); // The finger went stale and falls back to a full search.
+    a.swap(b);
+    EXPECT_EQ(a.back(), 100);
+    EXPECT_EQ(b.back(), 101);
+    std::swap(a, b);
+    EXPECT_TRUE(a.contains(101));
+    ExpectReverseMatches(a);
+}
+
+TEST(SkipListCopyMoveTest, ConcurrentReaderListsMoveWithRetiredNodes) {
+    rcu_list source;
+    for (int i = 0; i < 1000; ++i) {
+        source.insert(i);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        source.erase(i); // Retired, not yet reclaimed.
+    }
+    rcu_list moved(std::move(source));
+    EXPECT_EQ(moved.size(), 500u);
+    EXPECT_TRUE(source.insert(0));
+    source = moved;
+    EXPECT_EQ(source.size(), 500u);
+    for (int i = 1; i < 1000; i += 2) {
+        ASSERT_TRUE(moved.erase(i));
+    }
+    EXPECT_TRUE(moved.empty());
+    EXPECT_TRUE(source.contains(999));
+}
+
+TEST(SkipListSetAlgebraTest, MergeRelinksNodesWithoutAllocating) {
+    AllocationStats stats;
+    using list_type = skip_list<int, std::less<int>, CountingAllocator<int>>;
+    list_type target{CountingAllocator<int>(&stats)};
+    list_type source{CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 3000; i += 2) {
+        target.insert(i);
+    }
+    for (int i = 1; i < 3000; i += 2) {
+        source.insert(i);
+    }
+    const std::size_t allocations = stats.allocations;
+    target.merge(source);
+    EXPECT_EQ(stats.allocations, allocations);
+    EXPECT_TRUE(source.empty());
+    ASSERT_EQ(target.size(), 3000u);
+    int expected = 0;
+    for (int key : target) {
+        ASSERT_EQ(key, expected++);
+    }
+
+    for (int i = 0; i < 6000; i += 3) {
+        source.insert(i);
+    }
+    target.merge(source);
+    EXPECT_EQ(target.size(), 4000u);
+    EXPECT_EQ(source.size(), 1000u); // The multiples of 3 below 3000 were already present.
+    EXPECT_TRUE(std::is_sorted(source.begin(), source.end()));
+    EXPECT_EQ(*std::ranges::next(source.begin(), 999), 2997);
+    source.clear();
+    target.clear();
+    EXPECT_EQ(stats.live_bytes, 0u);
+}
+
+TEST(SkipListSetAlgebraTest, MergeAcrossUnequalAllocatorsMovesTheElements) {
+    AllocationStats target_stats;
+    AllocationStats source_stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type target{CountingAllocator<std::string>(&target_stats)};
+    list_type source{CountingAllocator<std::string>(&source_stats)};
+    for (const char* key : {"b", "d", "f"}) {
+        target.insert(key);
+    }
+    for (const char* key : {"a", "b", "c", "f", "g"}) {
+        source.insert(key);
+    }
+    target.merge(source);
+    EXPECT_EQ(std::vector<std::string>(target.begin(), target.end()),
+              (std::vector<std::string>{"a", "b", "c", "d", "f", "g"}));
+    EXPECT_EQ(std::vector<std::string>(source.begin(), source.end()), (std::vector<std::string>{"b", "f"}));
+    target.clear();
+    EXPECT_EQ(target_stats.live_bytes, 0u);
+    EXPECT_GT(source_stats.live_bytes, 0u);
+}
+
+struct FragileKey {
+    static inline int copies_left = 0;
+    int key;
+
+    explicit FragileKey(int k) : key(k) {}
+    FragileKey(const FragileKey& other) : key(other.key) {
+        if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    }
+    bool operator<(const FragileKey& other) const { return key < other.key; }
+};
+
+TEST(SkipListSetAlgebraTest, FailedMergeLosesNoElement) {
+    AllocationStats target_stats;
+    AllocationStats source_stats;
+    using list_type = skip_list<FragileKey, std::less<FragileKey>, CountingAllocator<FragileKey>>;
+    list_type target{CountingAllocator<FragileKey>(&target_stats)};
+    list_type source{CountingAllocator<FragileKey>(&source_stats)};
+    for (int i = 0; i < 100; ++i) {
+        target.emplace(2 * i);
+        source.emplace(3 * i);
+    }
+    FragileKey::copies_left = 20;
+    EXPECT_THROW(target.merge(source), std::runtime_error);
+    EXPECT_EQ(target.size() + source.size(), 166u + 34u);
+    EXPECT_GT(target.size(), 100u);
+    EXPECT_TRUE(std::is_sorted(target.begin(), target.end()));
+    EXPECT_TRUE(std::is_sorted(source.begin(), source.end()));
+
+    FragileKey::copies_left = 1000;
+    target.merge(source);
+    EXPECT_EQ(target.size(), 166u);
+    EXPECT_EQ(source.size(), 34u);
+}
+
+TEST(SkipListSetAlgebraTest, MergeKeepsIndexAndBackwardLinks) {
+    indexed_list target;
+    indexed_list source;
+    std::vector<int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        (i % 3 == 0 ? target : source).insert(i);
+        expected.push_back(i);
+    }
+    source.insert(0);
+    target.merge(source);
+    ExpectIndexMatches(target, expected);
+    ExpectIndexMatches(source, {0});
+
+    bidirectional_list front;
+    bidirectional_list back;
+    for (int i = 0; i < 500; ++i) {
+        front.insert(i);
+        back.insert(i + 250);
+    }
+    front.merge(back);
+    EXPECT_EQ(front.size(), 750u);
+    EXPECT_EQ(back.size(), 250u);
+    ExpectReverseMatches(front);
+    ExpectReverseMatches(back);
+
+    rcu_list shared;
+    rcu_list local;
+    for (int i = 0; i < 100; ++i) {
+        shared.insert(2 * i);
+        local.insert(3 * i);
+    }
+    shared.merge(local);
+    EXPECT_EQ(shared.size(), 166u);
+    EXPECT_EQ(local.size(), 34u); // The multiples of 6.
+}
+
+TEST(SkipListSetAlgebraTest, ExtractedNodesAreReinsertedWithoutAllocating) {
+    AllocationStats stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type list{CountingAllocator<std::string>(&stats)};
+    for (const char* key : {"apple", "banana", "cherry"}) {
+        list.insert(key);
+    }
+    const std::size_t allocations = stats.allocations;
+
+    list_type::node_type node = list.extract("banana");
+    ASSERT_FALSE(node.empty());
+    EXPECT_EQ(list.size(), 2u);
+    EXPECT_FALSE(list.contains("banana"));
+    node.value() = "blueberry";
+    auto result = list.insert(std::move(node));
+    EXPECT_TRUE(result.inserted);
+    EXPECT_EQ(*result.position, "blueberry");
+    EXPECT_TRUE(result.node.empty());
+    EXPECT_EQ(stats.allocations, allocations);
+
+    node = list.extract(list.begin());
+    EXPECT_EQ(node.value(), "apple");
+    node.value() = "cherry";
+    result = list.insert(std::move(node));
+    EXPECT_FALSE(result.inserted);
+    EXPECT_EQ(*result.position, "cherry");
+    ASSERT_TRUE(result.node);
+    EXPECT_EQ(result.node.value(), "cherry");
+
+    list_type other{CountingAllocator<std::string>(&stats)};
+    result.node.value() = "date";
+    EXPECT_TRUE(other.insert(std::move(result.node)).inserted);
+    EXPECT_TRUE(other.contains("date"));
+    EXPECT_TRUE(list.extract("missing").empty());
+    EXPECT_FALSE(list.insert(list_type::node_type()).inserted);
+
+    list.extract("cherry"); // Discarded: the node goes back to the pool.
+    EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"blueberry"}));
+}
+
+TEST(SkipListSetAlgebraTest, ExtractedNodesOutliveAMergeOfTheirList) {
+    AllocationStats stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type target{CountingAllocator<std::string>(&stats)};
+    list_type source{CountingAllocator<std::string>(&stats)};
+    for (int i = 0; i < 200; ++i) {
+        (i % 2 ? source : target).insert("key" + std::to_string(i));
+    }
+    list_type::node_type kept = source.extract("key1");
+    list_type::node_type dropped = source.extract("key3");
+    target.merge(source);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(target.size(), 198u);
+
+    dropped = list_type::node_type(); // Its node goes back to `source`, which still shares the memory.
+    for (int i = 0; i < 200; ++i) {
+        source.insert("fresh" + std::to_string(i));
+        target.erase("key" + std::to_string(i));
+    }
+    kept.value() = "fresh-kept";
+    EXPECT_TRUE(source.insert(std::move(kept)).inserted);
+    EXPECT_EQ(source.size(), 201u);
+    EXPECT_TRUE(target.empty());
+    for (int i = 0; i < 200; ++i) {
+        target.insert("again" + std::to_string(i));
+    }
+    target.clear(); // Releases only what `source` no longer references.
+    EXPECT_TRUE(source.contains("fresh-kept"));
+    EXPECT_EQ(std::ranges::count_if(source, [](const std::string& key) { return key.starts_with("fresh"); }), 201);
+    source.clear();
+    EXPECT_EQ(stats.live_bytes, 0u);
+}
+
+TEST(SkipListSetAlgebraTest, SetOperationsMatchTheStandardAlgorithms) {
+    std::mt19937 g(21);
+    for (auto [size_a, size_b] : {std::pair{0, 50}, std::pair{2000, 2000}, std::pair{5000, 20},
+                                  std::pair{20, 5000}, std::pair{1, 1}}) {
+        indexed_list a;
+        indexed_list b;
+        while (a.size() < static_cast<std::size_t>(size_a)) {
+            a.insert(static_cast<int>(g() % 10000));
+        }
+        while (b.size() < static_cast<std::size_t>(size_b)) {
+            b.insert(static_cast<int>(g() % 10000));
+        }
+
+        std::vector<int> expected;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ExpectIndexMatches(set_union(a, b), expected);
+
+        expected.clear();
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ExpectIndexMatches(set_intersection(a, b), expected);
+
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        ExpectIndexMatches(set_difference(a, b), expected);
+        expected.clear();
+        std::set_difference(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(expected));
+        ExpectIndexMatches(set_difference(b, a), expected);
+    }
+}
+
+TEST(SkipListSetAlgebraTest, EquivalentElementsComeFromTheFirstList) {
+    using list_type = skip_list<std::string, CaseInsensitiveLess>;
+    list_type small;
+    small.insert("Apple");
+    small.insert("Cherry");
+    list_type large;
+    for (int i = 0; i < 100; ++i) {
+        large.insert("key" + std::to_string(i));
+    }
+    large.insert("apple");
+    large.insert("cherry");
+
+    const list_type forward = set_union(small, large);
+    EXPECT_EQ(forward.size(), 102u);
+    EXPECT_EQ(*forward.find("APPLE"), "Apple");
+    const list_type backward = set_union(large, small);
+    EXPECT_EQ(*backward.find("APPLE"), "apple");
+    EXPECT_EQ(std::vector<std::string>(set_intersection(small, large).begin(), set_intersection(small, large).end()),
+              (std::vector<std::string>{"Apple", "Cherry"}));
+    EXPECT_EQ(*set_intersection(large, small).begin(), "apple");
+    EXPECT_EQ(set_difference(large, small).size(), 100u);
+    EXPECT_TRUE(set_difference(small, large).empty());
+}
+
+TEST(SkipListSplitConcatTest, SplitRewiresWithoutCopying) {
+    AllocationStats stats;
+    {
+        using list_type = skip_list<int, std::less<int>, CountingAllocator<int>>;
+        list_type list{CountingAllocator<int>(&stats)};
+        for (int i = 0; i < 1000; ++i) {
+            list.insert(i);
+        }
+        const std::size_t allocations = stats.allocations;
+        list_type tail = list.split_at(400);
+        EXPECT_EQ(stats.allocations, allocations + 1); // Only the tail's table of shared arenas.
+        ASSERT_EQ(list.size(), 400u);
+        ASSERT_EQ(tail.size(), 600u);
+        EXPECT_EQ(*list.begin(), 0);
+        EXPECT_EQ(*tail.begin(), 400);
+        EXPECT_EQ(*std::ranges::next(list.begin(), 399), 399);
+        EXPECT_EQ(std::ranges::distance(tail), 600);
+        EXPECT_FALSE(list.contains(400));
+        EXPECT_TRUE(tail.contains(999));
+
+        EXPECT_TRUE(list.insert(5000)); // A list may hold keys past the cut afterwards.
+        EXPECT_TRUE(tail.erase(500));
+        EXPECT_TRUE(tail.insert(-1));
+        EXPECT_TRUE(list.split_at(1'000'000).empty());
+        list_type everything = tail.split_at(-5);
+        EXPECT_TRUE(tail.empty());
+        EXPECT_EQ(everything.size(), 600u);
+        tail.insert(7);
+        EXPECT_EQ(*tail.begin(), 7);
+    }
+    EXPECT_EQ(stats.live_bytes, 0u);
+}
+
+TEST(SkipListSplitConcatTest, IndexedSplitAndConcatKeepTheRanks) {
+    std::mt19937 g(23);
+    std::set<int> reference;
+    indexed_list list;
+    while (reference.size() < 3000) {
+        const int key = static_cast<int>(g() % 100000);
+        reference.insert(key);
+        list.insert(key);
+    }
+    for (int cut : {-1, 0, 17, 4999, 50000, 99999, 100000}) {
+        indexed_list tail = list.split_at(cut);
+        ExpectIndexMatches(list, std::vector<int>(reference.begin(), reference.lower_bound(cut)));
+        ExpectIndexMatches(tail, std::vector<int>(reference.lower_bound(cut), reference.end()));
+        list.concat(std::move(tail));
+        EXPECT_TRUE(tail.empty());
+        ExpectIndexMatches(list, std::vector<int>(reference.begin(), reference.end()));
+    }
+
+    indexed_list low; // Default heights: appending a taller list raises the height.
+    low.insert(-10);
+    low.concat(std::move(list));
+    reference.insert(-10);
+    ExpectIndexMatches(low, std::vector<int>(reference.begin(), reference.end()));
+}
+
+TEST(SkipListSplitConcatTest, SplitAndConcatKeepBackwardLinks) {
+    bidirectional_list list;
+    for (int i = 0; i < 500; ++i) {
+        list.insert(i * 2);
+    }
+    bidirectional_list tail = list.split_at(301);
+    ExpectReverseMatches(list);
+    ExpectReverseMatches(tail);
+    EXPECT_EQ(*std::prev(list.end()), 300);
+    EXPECT_EQ(*tail.begin(), 302);
+    tail.insert(301);
+    list.erase(300);
+    list.concat(std::move(tail));
+    ExpectReverseMatches(list);
+    EXPECT_EQ(list.size(), 500u);
+    EXPECT_EQ(*std::prev(list.end()), 998);
+}
+
+TEST(SkipListSplitConcatTest, ConcatRejectsOverlappingRanges) {
+    skip_list<int> list;
+    skip_list<int> other;
+    for (int i = 0; i < 10; ++i) {
+        list.insert(i);
+        other.insert(i + 9);
+    }
+    EXPECT_THROW(list.concat(std::move(other)), std::invalid_argument);
+    EXPECT_EQ(list.size(), 10u);
+    EXPECT_EQ(other.size(), 10u);
+    other.erase(9);
+    list.concat(std::move(other));
+    EXPECT_EQ(list.size(), 19u);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    list.concat(std::move(other)); // Appending an empty list changes nothing.
+    EXPECT_EQ(list.size(), 19u);
+}
+
+TEST(SkipListSplitConcatTest, ExtractedNodesOutliveAConcatOfTheirList) {
+    AllocationStats stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type list{CountingAllocator<std::string>(&stats)};
+    list_type other{CountingAllocator<std::string>(&stats)};
+    for (int i = 0; i < 100; ++i) {
+        list.insert(std::to_string(1000 + i));
+        other.insert(std::to_string(2000 + i));
+    }
+    list_type::node_type node = other.extract("2000");
+    list.concat(std::move(other));
+    EXPECT_EQ(list.size(), 199u);
+
+    node = list_type::node_type(); // Its node goes back to `other`, which still shares the memory.
+    for (int i = 0; i < 100; ++i) {
+        other.insert(std::to_string(3000 + i));
+    }
+    list.clear();
+    EXPECT_EQ(other.size(), 100u);
+    EXPECT_EQ(*other.begin(), "3000");
+    other.clear();
+    EXPECT_EQ(stats.live_bytes, 0u);
+}
+
+TEST(SkipListSplitConcatTest, ConcatAcrossUnequalAllocatorsMovesTheElements) {
+    AllocationStats target_stats;
+    AllocationStats source_stats;
+    using list_type = skip_list<std::string, std::less<std::string>, CountingAllocator<std::string>>;
+    list_type target{CountingAllocator<std::string>(&target_stats)};
+    list_type source{CountingAllocator<std::string>(&source_stats)};
+    target.insert("a");
+    target.insert("b");
+    source.insert("c");
+    source.insert("d");
+    target.concat(std::move(source));
+    EXPECT_EQ(std::vector<std::string>(target.begin(), target.end()),
+              (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_TRUE(source.empty());
+    target.clear();
+    EXPECT_EQ(target_stats.live_bytes, 0u);
+}
+
+/// The histogram balanced heights give the elements at 1-based positions [first, last).
+std::vector<std::size_t> BalancedHistogram(std::size_t first, std::size_t last) {
+    std::vector<std::size_t> counts(skip_list_traits::max_height);
+    for (std::size_t position = first; position < last; ++position) {
+        ++counts[static_cast<std::size_t>(std::countr_zero(position))];
+    }
+    return counts;
+}
+
+template<typename List>
+std::vector<std::size_t> Histogram(const List& list) {
+    const auto counts = list.level_histogram();
+    return std::vector<std::size_t>(counts.begin(), counts.end());
+}
+
+template<typename List>
+void ExpectHistogramMatchesSize(const List& list) {
+    const auto counts = list.level_histogram();
+    EXPECT_EQ(std::accumulate(counts.begin(), counts.end(), std::size_t{0}), list.size());
+    const auto tallest = std::find_if(counts.rbegin(), counts.rend(), [](std::size_t count) { return count != 0; });
+    EXPECT_EQ(list.height(), static_cast<int>(counts.rend() - tallest));
+}
+
+struct LevelCountsTraits : skip_list_traits {
+    static constexpr bool level_counts = true;
+};
+
+struct IndexedLevelCountsTraits : IndexedTraits {
+    static constexpr bool level_counts = true;
+};
+
+template<typename List>
+class SkipListHistogramTest : public ::testing::Test {};
+
+using HistogramLists = ::testing::Types<skip_list<int>, indexed_list,
+                                        skip_list<int, std::less<int>, std::allocator<int>, LevelCountsTraits>,
+                                        skip_list<int, std::less<int>, std::allocator<int>, IndexedLevelCountsTraits>>;
+TYPED_TEST_SUITE(SkipListHistogramTest, HistogramLists);
+
+TYPED_TEST(SkipListHistogramTest, CountsFollowSplitsAndConcats) {
+    constexpr int count = 1000;
+    std::vector<int> keys(count);
+    std::iota(keys.begin(), keys.end(), 1);
+    TypeParam list;
+    list.insert_sorted(keys.begin(), keys.end(), tower_heights::balanced);
+    EXPECT_EQ(Histogram(list), BalancedHistogram(1, count + 1));
+    EXPECT_EQ(list.height(), 10); // Position 512.
+
+    for (int cut : {1, 100, 500, 900, 1001}) {
+        TypeParam tail = list.split_at(cut);
+        const auto kept = static_cast<std::size_t>(cut - 1);
+        EXPECT_EQ(Histogram(list), BalancedHistogram(1, kept + 1)) << cut;
+        EXPECT_EQ(Histogram(tail), BalancedHistogram(kept + 1, count + 1)) << cut;
+        ExpectHistogramMatchesSize(list);
+        ExpectHistogramMatchesSize(tail);
+        list.concat(std::move(tail));
+        EXPECT_EQ(Histogram(list), BalancedHistogram(1, count + 1));
+        EXPECT_EQ(Histogram(tail), std::vector<std::size_t>(skip_list_traits::max_height));
+    }
+
+    EXPECT_TRUE(list.erase(512));
+    EXPECT_EQ(list.erase_range(1, 11), 10u);
+    auto expected = BalancedHistogram(11, count + 1);
+    --expected[9];
+    EXPECT_EQ(Histogram(list), expected);
+    list.clear();
+    EXPECT_EQ(Histogram(list), std::vector<std::size_t>(skip_list_traits::max_height));
+    EXPECT_EQ(list.height(), 0);
+}
+
+TYPED_TEST(SkipListHistogramTest, CountsFollowEveryMutation) {
+    std::mt19937 g(29);
+    TypeParam list;
+    TypeParam other;
+    for (int i = 0; i < 2000; ++i) {
+        list.insert(static_cast<int>(g() % 3000));
+        other.insert(static_cast<int>(g() % 3000) + 2000);
+    }
+    ExpectHistogramMatchesSize(list);
+    for (int i = 0; i < 500; ++i) {
+        list.erase(static_cast<int>(g() % 3000));
+    }
+    ExpectHistogramMatchesSize(list);
+
+    auto node = list.extract(list.begin());
+    ExpectHistogramMatchesSize(list);
+    other.insert(std::move(node));
+    ExpectHistogramMatchesSize(other);
+    list.merge(other);
+    ExpectHistogramMatchesSize(list);
+    ExpectHistogramMatchesSize(other);
+    list.pop_front();
+    ExpectHistogramMatchesSize(list);
+
+    TypeParam copy = list;
+    EXPECT_EQ(Histogram(copy), Histogram(list));
+    TypeParam moved = std::move(copy);
+    EXPECT_EQ(Histogram(moved), Histogram(list));
+    EXPECT_EQ(Histogram(copy), std::vector<std::size_t>(skip_list_traits::max_height));
+}
+
+struct ConcurrentLevelCountsTraits : ConcurrentReaderTraits {
+    static constexpr bool level_counts = true;
+};
+
+template<typename List>
+void ReadHistogramsAlongsideOneWriter() {
+    constexpr int key_range = 1 << 12;
+    List list;
+    for (int key = 0; key < key_range; key += 2) {
+        list.insert(key); // Even keys are never erased.
+    }
+    std::atomic<bool> stop{false};
+    std::atomic<int> failures{0};
+
+    std::thread metrics([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            const auto counts = list.level_histogram();
+            const std::size_t total = std::accumulate(counts.begin(), counts.end(), std::size_t{0});
+            failures += total < key_range / 2 || total > key_range;
+        }
+    });
+
+    std::mt19937 g(5);
+    for (int round = 0; round < 20000; ++round) {
+        const int key = static_cast<int>(g() % key_range) | 1;
+        list.insert(key);
+        list.erase(key);
+    }
+    stop = true;
+    metrics.join();
+    EXPECT_EQ(failures.load(), 0);
+    ExpectHistogramMatchesSize(list);
+}
+
+TEST(SkipListConcurrentReadersTest, HistogramReadsRunAlongsideOneWriter) {
+    ReadHistogramsAlongsideOneWriter<rcu_list>();
+    ReadHistogramsAlongsideOneWriter<skip_list<int, std::less<int>, std::allocator<int>, ConcurrentLevelCountsTraits>>();
+}
+
+TEST(SkipListMemoryUsageTest, ReportsThePoolMemory) {
+    AllocationStats stats;
+    using list_type = skip_list<int, std::less<int>, CountingAllocator<int>>;
+    list_type list{CountingAllocator<int>(&stats)};
+    EXPECT_EQ(list.memory_usage().total(), sizeof(list_type));
+
+    for (int i = 0; i < 10000; ++i) {
+        list.insert(i);
+    }
+    const skip_list_memory_usage full = list.memory_usage();
+    EXPECT_EQ(full.container, sizeof(list_type));
+    EXPECT_GE(full.nodes, list.size() * sizeof(int));
+    EXPECT_GE(full.towers, list.size() * sizeof(void*));
+    const std::size_t pool_bytes = full.nodes + full.towers + full.slack;
+    EXPECT_LE(pool_bytes, stats.live_bytes); // The rest is the arena bookkeeping.
+    EXPECT_GE(pool_bytes + 1024, stats.live_bytes);
+    EXPECT_LT(full.slack, pool_bytes / 8);
+
+    for (int i = 0; i < 10000; i += 2) {
+        list.erase(i);
+    }
+    const skip_list_memory_usage half = list.memory_usage();
+    EXPECT_EQ(half.nodes * 2, full.nodes);
+    EXPECT_EQ(half.nodes + half.towers + half.slack, pool_bytes); // Erased nodes stay in the pool.
+
+    const auto counts = list.level_histogram();
+    std::size_t links = 0;
+    for (std::size_t h = 1; h <= counts.size(); ++h) {
+        links += counts[h - 1] * h;
+    }
+    EXPECT_EQ(half.towers, links * sizeof(void*));
+
+    list.clear();
+    const skip_list_memory_usage empty = list.memory_usage();
+    EXPECT_EQ(empty.nodes + empty.towers + empty.slack, 0u);
+}
+
+struct StatisticsTraits : skip_list_traits {
+    static constexpr bool statistics = true;
+};
+
+struct FingerStatisticsTraits : StatisticsTraits {
+    static constexpr bool last_access_finger = true;
+};
+
+struct ConcurrentStatisticsTraits : StatisticsTraits {
+    static constexpr bool concurrent_readers = true;
+};
+
+template<typename List>
+concept HasStatistics = requires(const List& list) { list.statistics(); };
+
+static_assert(!HasStatistics<skip_list<int>>, "Statistics are opt-in.");
+static_assert(HasStatistics<skip_list<int, std::less<int>, std::allocator<int>, StatisticsTraits>>);
+
+TEST(SkipListStatisticsTest, CountsTheStepsOfEveryDescent) {
+    using list_type = skip_list<int, std::less<int>, std::allocator<int>, StatisticsTraits>;
+    const std::vector<int> keys{1, 2, 3, 4, 5, 6, 7, 8};
+    list_type list;
+    list.insert_sorted(keys.begin(), keys.end(), tower_heights::balanced); // Heights 1 2 1 3 1 2 1 4.
+    EXPECT_EQ(list.statistics().height_grows, 4u);
+    EXPECT_EQ(list.statistics().height_shrinks, 0u);
+
+    list.reset_statistics();
+    EXPECT_TRUE(list.contains(7)); // 8 (stop), 4, 8 (stop), 6, 8 (stop), 7 (found).
+    auto stats = list.statistics();
+    EXPECT_EQ(stats.searches, 1u);
+    EXPECT_EQ(stats.comparisons, 6u);
+    EXPECT_EQ(stats.level_hops[0], 0u);
+    EXPECT_EQ(stats.level_hops[1], 1u);
+    EXPECT_EQ(stats.level_hops[2], 1u);
+    EXPECT_EQ(stats.level_hops[3], 0u);
+
+    EXPECT_FALSE(list.insert(8));
+    EXPECT_FALSE(list.insert(3));
+    stats = list.statistics();
+    EXPECT_EQ(stats.searches, 3u);
+    EXPECT_EQ(stats.duplicate_inserts, 2u);
+
+    EXPECT_TRUE(list.erase(8));
+    EXPECT_EQ(list.statistics().height_shrinks, 1u);
+    EXPECT_EQ(list.lower_bound(5), list.find(5));
+    EXPECT_EQ(list.statistics().searches, 6u);
+    list.clear();
+    EXPECT_EQ(list.statistics().height_shrinks, 2u);
+}
+
+TEST(SkipListStatisticsTest, CountsBoundAndBatchLookups) {
+    using list_type = skip_list<int, std::less<int>, std::allocator<int>, StatisticsTraits>;
+    const std::vector<int> keys{1, 2, 3, 4, 5, 6, 7, 8};
+    list_type list;
+    list.insert_sorted(keys.begin(), keys.end(), tower_heights::balanced); // Heights 1 2 1 3 1 2 1 4.
+    list.reset_statistics();
+    EXPECT_EQ(*list.upper_bound(6), 7); // 8 (stop), 4, 8 (stop), 6, 8 (stop), 7 (stop).
+    auto stats = list.statistics();
+    EXPECT_EQ(stats.searches, 1u);
+    EXPECT_EQ(stats.comparisons, 6u);
+    EXPECT_EQ(stats.level_hops[1], 1u);
+    EXPECT_EQ(stats.level_hops[2], 1u);
+    list.equal_range(3);
+    EXPECT_EQ(list.statistics().searches, 2u);
+
+    bool found[8];
+    list.reset_statistics();
+    list.contains_batch(keys, found); // Sorted: one finger sweep.
+    EXPECT_EQ(list.statistics().searches, keys.size());
+    EXPECT_GE(list.statistics().comparisons, keys.size());
+
+    list_type large;
+    std::vector<int> all(1 << 17);
+    std::iota(all.begin(), all.end(), 0);
+    large.insert_sorted(all.begin(), all.end());
+    large.reset_statistics();
+    const std::vector<int> scattered{70000, 3, 129999, 42, 100000, 7, 65536, 1};
+    large.contains_batch(scattered, found); // Unsorted on a large list: interleaved lanes.
+    EXPECT_TRUE(std::all_of(std::begin(found), std::end(found), [](bool hit) { return hit; }));
+    stats = large.statistics();
+    EXPECT_EQ(stats.searches, scattered.size());
+    EXPECT_GT(stats.comparisons, scattered.size() * 10);
+    EXPECT_GT(std::accumulate(std::begin(stats.level_hops), std::end(stats.level_hops), std::uint64_t{0}), 0u);
+}
+
+TEST(SkipListStatisticsTest, CountsFingerAndConcurrentSearches) {
+    skip_list<int, std::less<int>, std::allocator<int>, FingerStatisticsTraits> fingered;
+    for (int i = 0; i < 1000; ++i) {
+        fingered.insert(i);
+    }
+    EXPECT_EQ(fingered.statistics().searches, 1000u);
+    EXPECT_LT(fingered.statistics().comparisons, 4000u); // Ascending inserts bracket the key from the finger.
+    EXPECT_FALSE(fingered.insert(500));
+    EXPECT_EQ(fingered.statistics().duplicate_inserts, 1u);
+
+    skip_list<int, std::less<int>, std::allocator<int>, ConcurrentStatisticsTraits> shared;
+    for (int i = 0; i < 1000; ++i) {
+        shared.insert(i);
+    }
+    shared.reset_statistics();
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&shared] {
+            for (int i = 0; i < 1000; ++i) {
+                EXPECT_TRUE(shared.contains(i));
+            }
+        });
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    const auto stats = shared.statistics();
+    EXPECT_EQ(stats.searches, 4000u);
+    EXPECT_GE(stats.comparisons, 4000u);
+}
+
 TEST(SkipListStressTest, InsertAndEraseManyElements) {
     skip_list<int> list;
     const int num_elements = 1000;
@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+#include "skip_list_view.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+/// Holds a saved image in suitably aligned memory.
+struct image_buffer {
+    std::vector<std::uint64_t> words;
+    std::size_t bytes = 0;
+
+    template<typename List>
+    explicit image_buffer(const List& list) {
+        std::ostringstream out(std::ios::binary);
+        list.save(out);
+        const std::string image = out.str();
+        bytes = image.size();
+        words.resize((bytes + 7) / 8);
+        std::copy(image.begin(), image.end(), reinterpret_cast<char*>(words.data()));
+    }
+
+    std::span<const std::byte> span() const { return {reinterpret_cast<const std::byte*>(words.data()), bytes}; }
+};
+
+/// A file removed when the test ends.
+struct temporary_file {
+    std::string path = "/tmp/skip_list_view_test_" + std::to_string(::getpid()) + ".img";
+    ~temporary_file() { std::remove(path.c_str()); }
+};
+
+struct IndexedTraits : skip_list_traits {
+    static constexpr bool indexed = true;
+};
+
+struct alignas(16) Point {
+    std::int64_t x;
+    std::int32_t y;
+};
+
+struct ByY {
+    bool operator()(const Point& a, const Point& b) const { return a.y < b.y; }
+};
+
+} // namespace
+
+TEST(SkipListViewTest, LookupsMatchTheSavedList) {
+    std::mt19937 g(29);
+    std::set<int> reference;
+    skip_list<int> list;
+    while (reference.size() < 5000) {
+        const int key = static_cast<int>(g() % 50000);
+        reference.insert(key);
+        list.insert(key);
+    }
+    const image_buffer image(list);
+    const skip_list_view<int> view(image.span());
+    ASSERT_EQ(view.size(), reference.size());
+    EXPECT_TRUE(std::ranges::equal(view, reference));
+    for (int key = -5; key < 50005; key += 7) {
+        ASSERT_EQ(view.contains(key), reference.contains(key)) << key;
+        const auto lower = view.lower_bound(key);
+        const auto expected = reference.lower_bound(key);
+        ASSERT_EQ(lower == view.end(), expected == reference.end()) << key;
+        if (expected != reference.end()) {
+            ASSERT_EQ(*lower, *expected);
+        }
+        const auto upper = view.upper_bound(key);
+        const auto expected_upper = reference.upper_bound(key);
+        ASSERT_EQ(upper == std::default_sentinel, expected_upper == reference.end()) << key;
+        if (expected_upper != reference.end()) {
+            ASSERT_EQ(*upper, *expected_upper);
+        }
+    }
+    EXPECT_EQ(*view.find(*reference.begin()), *reference.begin());
+    EXPECT_EQ(view.find(-1), view.end());
+}
+
+TEST(SkipListViewTest, EmptyListsAndOtherTraits) {
+    const skip_list<int> empty;
+    const image_buffer empty_image(empty);
+    const skip_list_view<int> empty_view(empty_image.span());
+    EXPECT_TRUE(empty_view.empty());
+    EXPECT_EQ(empty_view.begin(), empty_view.end());
+    EXPECT_FALSE(empty_view.contains(0));
+
+    skip_list<int, std::less<int>, std::allocator<int>, IndexedTraits> indexed;
+    for (int i = 0; i < 1000; ++i) {
+        indexed.insert(i * 3);
+    }
+    const image_buffer image(indexed);
+    skip_list_view<int> view(image.span());
+    EXPECT_EQ(view.size(), 1000u);
+    EXPECT_TRUE(view.contains(2997));
+    EXPECT_FALSE(view.contains(2998));
+
+    const auto first = view.begin();
+    skip_list_view<int> moved(std::move(view));
+    EXPECT_EQ(*first, 0); // Iterators outlive the view they came from, but not the image.
+    EXPECT_EQ(std::ranges::distance(moved), 1000);
+}
+
+TEST(SkipListViewTest, OverAlignedKeysWithACustomOrder) {
+    skip_list<Point, ByY> list;
+    for (int i = 0; i < 300; ++i) {
+        list.insert(Point{-i, i * 2});
+    }
+    const image_buffer image(list);
+    const skip_list_view<Point, ByY> view(image.span());
+    ASSERT_EQ(view.size(), 300u);
+    EXPECT_EQ(view.find(Point{0, 100})->x, -50);
+    EXPECT_EQ(view.lower_bound(Point{0, 101})->y, 102);
+    EXPECT_EQ(view.find(Point{0, 101}), view.end());
+    int expected_y = 0;
+    for (const Point& point : view) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&point) % alignof(Point), 0u);
+        ASSERT_EQ(point.y, expected_y);
+        expected_y += 2;
+    }
+}
+
+TEST(SkipListViewTest, MapsASavedFile) {
+    skip_list<std::uint64_t> list;
+    for (std::uint64_t i = 0; i < 100000; ++i) {
+        list.insert(i * i);
+    }
+    const temporary_file file;
+    const int fd = ::open(file.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    ASSERT_GE(fd, 0);
+    save_image(list, fd);
+    ASSERT_EQ(::close(fd), 0);
+
+    const skip_list_view<std::uint64_t> view(file.path);
+    EXPECT_EQ(view.size(), 100000u);
+    EXPECT_TRUE(view.contains(99999ull * 99999ull));
+    EXPECT_FALSE(view.contains(2));
+    EXPECT_EQ(*view.upper_bound(10), 16u);
+    EXPECT_TRUE(std::ranges::equal(view, list));
+}
+
+TEST(SkipListViewTest, RejectsForeignImages) {
+    skip_list<int> list;
+    list.insert(1);
+    const image_buffer image(list);
+    EXPECT_THROW(skip_list_view<long long>{image.span()}, std::invalid_argument);
+    EXPECT_THROW(skip_list_view<int>{image.span().first(image.bytes - 8)}, std::invalid_argument);
+    EXPECT_THROW(skip_list_view<int>{image.span().first(10)}, std::invalid_argument);
+
+    image_buffer corrupted(list);
+    reinterpret_cast<char*>(corrupted.words.data())[0] = 'X';
+    EXPECT_THROW(skip_list_view<int>{corrupted.span()}, std::invalid_argument);
+
+    EXPECT_THROW(skip_list_view<int>{std::string("/nonexistent/skip_list.img")}, std::system_error);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
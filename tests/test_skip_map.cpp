@@ -0,0 +1,231 @@
+#include "gtest/gtest.h"
+#include "skip_map.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <iterator>
+#include <ranges>
+
+TEST(SkipMapInitializationTest, DefaultConstructor) {
+    skip_map<int, std::string> map;
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+class SkipMapBasicOpsTest : public ::testing::Test {
+protected:
+    skip_map<int, std::string> map;
+};
+
+TEST_F(SkipMapBasicOpsTest, SubscriptInsertsAndUpdates) {
+    map[2] = "two";
+    map[1] = "one";
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map[2], "two");
+
+    map[2] = "deux";
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(2), "deux");
+}
+
+TEST_F(SkipMapBasicOpsTest, SubscriptValueInitializesMissingEntries) {
+    skip_map<std::string, int> counts;
+    ++counts["a"];
+    ++counts["a"];
+    ++counts["b"];
+    EXPECT_EQ(counts.at("a"), 2);
+    EXPECT_EQ(counts.at("b"), 1);
+}
+
+TEST_F(SkipMapBasicOpsTest, TryEmplaceDoesNotOverwrite) {
+    auto [it, inserted] = map.try_emplace(5, 3, 'x');
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(it->first, 5);
+    EXPECT_EQ(it->second, "xxx");
+
+    auto [again, inserted_again] = map.try_emplace(5, "other");
+    EXPECT_FALSE(inserted_again);
+    EXPECT_EQ(again, it);
+    EXPECT_EQ(again->second, "xxx");
+}
+
+TEST_F(SkipMapBasicOpsTest, TryEmplaceLeavesArgumentsAloneOnDuplicate) {
+    skip_map<int, std::unique_ptr<int>> owners;
+    ASSERT_TRUE(owners.try_emplace(1, std::make_unique<int>(10)).second);
+
+    auto payload = std::make_unique<int>(20);
+    EXPECT_FALSE(owners.try_emplace(1, std::move(payload)).second);
+    ASSERT_NE(payload, nullptr);
+    EXPECT_EQ(*owners.at(1), 10);
+}
+
+TEST_F(SkipMapBasicOpsTest, InsertOrAssign) {
+    EXPECT_TRUE(map.insert_or_assign(7, "seven").second);
+    auto [it, inserted] = map.insert_or_assign(7, "sept");
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, "sept");
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST_F(SkipMapBasicOpsTest, AtThrowsForMissingKey) {
+    EXPECT_THROW(map.at(42), std::out_of_range);
+    const auto& cmap = map;
+    EXPECT_THROW(cmap.at(42), std::out_of_range);
+}
+
+TEST_F(SkipMapBasicOpsTest, IterationIsOrderedByKey) {
+    for (int key : {30, 10, 20}) {
+        map[key] = std::to_string(key);
+    }
+    std::vector<int> keys;
+    for (auto& [key, value] : map) {
+        EXPECT_EQ(value, std::to_string(key));
+        keys.push_back(key);
+    }
+    EXPECT_EQ(keys, (std::vector<int>{10, 20, 30}));
+}
+
+TEST_F(SkipMapBasicOpsTest, EraseByKey) {
+    map[1] = "one";
+    map[2] = "two";
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_TRUE(map.contains(2));
+}
+
+TEST(SkipMapHeterogeneousLookupTest, FindByStringView) {
+    skip_map<std::string, int, std::less<>> map;
+    map["alpha"] = 1;
+    map["beta"] = 2;
+
+    std::string_view probe = "beta";
+    auto it = map.find(probe);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, 2);
+    EXPECT_TRUE(map.contains(std::string_view("alpha")));
+    EXPECT_EQ(map.find(std::string_view("gamma")), map.end());
+    EXPECT_TRUE(map.erase(std::string_view("alpha")));
+    EXPECT_FALSE(map.contains(std::string_view("alpha")));
+}
+
+struct CountedKey {
+    static inline int constructions = 0;
+
+    int id;
+
+    explicit CountedKey(int i) : id(i) { ++constructions; }
+    CountedKey(const CountedKey& other) : id(other.id) { ++constructions; }
+    CountedKey(CountedKey&& other) noexcept : id(other.id) { ++constructions; }
+};
+
+struct CountedKeyLess {
+    using is_transparent = void;
+
+    bool operator()(const CountedKey& a, const CountedKey& b) const { return a.id < b.id; }
+    bool operator()(const CountedKey& a, int b) const { return a.id < b; }
+    bool operator()(int a, const CountedKey& b) const { return a < b.id; }
+};
+
+TEST(SkipMapHeterogeneousLookupTest, ProbesDoNotBuildTemporaryKeys) {
+    skip_map<CountedKey, int, CountedKeyLess> map;
+    for (int i = 0; i < 100; ++i) {
+        map.try_emplace(CountedKey(i), i * 10);
+    }
+
+    const int before = CountedKey::constructions;
+    for (int i = 0; i < 100; ++i) {
+        auto it = map.find(i);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->second, i * 10);
+        EXPECT_TRUE(map.contains(i));
+    }
+    EXPECT_FALSE(map.contains(1000));
+    EXPECT_EQ(CountedKey::constructions, before);
+}
+
+TEST(SkipMapIteratorTest, ConstIteratorIsReadOnly) {
+    using map_type = skip_map<int, std::string>;
+    static_assert(std::forward_iterator<map_type::iterator>);
+    static_assert(std::forward_iterator<map_type::const_iterator>);
+    static_assert(std::is_same_v<std::iter_reference_t<map_type::iterator>, std::pair<const int, std::string>&>);
+    static_assert(std::is_same_v<std::iter_reference_t<map_type::const_iterator>, const std::pair<const int, std::string>&>);
+    static_assert(std::is_same_v<decltype(std::declval<const map_type&>().begin()), map_type::const_iterator>);
+    static_assert(std::is_convertible_v<map_type::iterator, map_type::const_iterator>);
+    static_assert(!std::is_convertible_v<map_type::const_iterator, map_type::iterator>);
+
+    map_type map;
+    map[1] = "one";
+    map[2] = "two";
+    map.find(2)->second = "deux";
+
+    const map_type& cmap = map;
+    map_type::const_iterator it = map.begin();
+    EXPECT_EQ(it, cmap.begin());
+    EXPECT_EQ(map.begin(), cmap.cbegin());
+    EXPECT_NE(it, map.end());
+    EXPECT_EQ(cmap.find(2)->second, "deux");
+    EXPECT_EQ(map.erase(cmap.begin(), cmap.find(2)), map.find(2));
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(SkipMapIteratorTest, KeysView) {
+    skip_map<int, std::string> map;
+    for (int key : {3, 1, 2}) {
+        map[key] = std::to_string(key);
+    }
+    std::vector<int> keys;
+    for (int key : map | std::views::keys) {
+        keys.push_back(key);
+    }
+    EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+    for (auto& value : map | std::views::values) {
+        value += "!";
+    }
+    EXPECT_EQ(map.at(2), "2!");
+}
+
+TEST(SkipMapCopyMoveTest, CopiesAreDeepAndMovesStealTheEntries) {
+    skip_map<int, std::unique_ptr<std::string>> owners;
+    owners.try_emplace(1, std::make_unique<std::string>("one"));
+    owners.try_emplace(2, std::make_unique<std::string>("two"));
+    const std::string* two = owners.at(2).get();
+    skip_map<int, std::unique_ptr<std::string>> moved(std::move(owners));
+    EXPECT_EQ(moved.at(2).get(), two);
+    EXPECT_TRUE(owners.empty());
+
+    skip_map<int, std::string> map;
+    map[1] = "un";
+    map[2] = "deux";
+    skip_map<int, std::string> copy = map;
+    copy[1] = "one";
+    EXPECT_EQ(map.at(1), "un");
+    map = copy;
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_EQ(map.size(), 2u);
+}
+
+TEST(SkipMapSplitConcatTest, SplitMapsConcatenateBack) {
+    skip_map<int, std::string> map;
+    for (int i = 0; i < 100; ++i) {
+        map[i] = std::to_string(i);
+    }
+    skip_map<int, std::string> upper = map.split_at(60);
+    EXPECT_EQ(map.size(), 60u);
+    EXPECT_EQ(upper.size(), 40u);
+    EXPECT_EQ(upper.at(60), "60");
+    EXPECT_FALSE(map.contains(60));
+    upper[200] = "200";
+    map.concat(std::move(upper));
+    EXPECT_EQ(map.size(), 101u);
+    EXPECT_EQ(map.at(200), "200");
+    EXPECT_TRUE(upper.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
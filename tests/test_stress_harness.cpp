@@ -0,0 +1,170 @@
+#include "gtest/gtest.h"
+#include "concurrent_skip_list.hpp"
+#include "sharded_skip_list.hpp"
+#include "stress_harness.hpp"
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using stress::operation;
+using stress::operation_kind;
+
+/// A small, contended workload: few keys, so every key sees many overlapping calls.
+stress::workload checked_workload(unsigned read_percent, stress::key_distribution distribution) {
+    stress::workload w;
+    w.threads = 4;
+    w.read_percent = read_percent;
+    w.key_range = 64;
+    w.distribution = distribution;
+    w.ops_per_thread = 5000;
+    w.check_linearizability = true;
+    return w;
+}
+
+/// Checks and forgets the result of every call: erase() racing itself can succeed twice.
+class racy_set {
+    std::mutex mutex_;
+    skip_list<std::uint64_t> list_;
+
+public:
+    using key_type = std::uint64_t;
+
+    bool insert(key_type key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.insert(key);
+    }
+
+    bool erase(key_type key) {
+        bool present;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            present = list_.contains(key);
+        }
+        std::this_thread::yield();
+        std::lock_guard<std::mutex> lock(mutex_);
+        list_.erase(key);
+        return present;
+    }
+
+    bool contains(key_type key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return list_.contains(key);
+    }
+};
+
+} // namespace
+
+TEST(LatencyHistogramTest, PercentilesWithinBucketPrecision) {
+    stress::latency_histogram h;
+    EXPECT_EQ(h.percentile(0.5), 0u);
+    for (std::uint64_t v = 1; v <= 100000; ++v) {
+        h.record(v);
+    }
+    EXPECT_EQ(h.count(), 100000u);
+    EXPECT_NEAR(static_cast<double>(h.percentile(0.5)), 50000.0, 50000.0 * 0.04);
+    EXPECT_NEAR(static_cast<double>(h.percentile(0.99)), 99000.0, 99000.0 * 0.04);
+    EXPECT_GE(h.percentile(0.999), h.percentile(0.99));
+    EXPECT_GE(h.percentile(1.0), 100000u);
+
+    stress::latency_histogram small;
+    for (std::uint64_t v = 0; v < 32; ++v) {
+        small.record(v);
+    }
+    EXPECT_EQ(small.percentile(0.5), 15u); // Exact below 32.
+    h.merge(small);
+    EXPECT_EQ(h.count(), 100032u);
+}
+
+TEST(LinearizabilityCheckerTest, AcceptsOverlappingCalls) {
+    // insert(1) overlaps contains(1) == false and erase(1) == true: contains, insert, erase.
+    const std::vector<operation> history{
+        {1, 0, 5, operation_kind::insert, true},
+        {1, 1, 2, operation_kind::contains, false},
+        {1, 3, 6, operation_kind::erase, true},
+        {1, 7, 8, operation_kind::contains, false},
+        {2, 4, 9, operation_kind::erase, false},
+    };
+    EXPECT_FALSE(stress::find_violation(history));
+    EXPECT_FALSE(stress::find_violation({}));
+}
+
+TEST(LinearizabilityCheckerTest, RejectsStaleReads) {
+    // contains(1) starts after insert(1) returned, yet misses it.
+    const std::vector<operation> stale{
+        {3, 0, 1, operation_kind::insert, true},
+        {1, 2, 3, operation_kind::insert, true},
+        {1, 4, 5, operation_kind::contains, false},
+    };
+    EXPECT_EQ(stress::find_violation(stale), std::optional<std::uint64_t>(1));
+
+    // Two concurrent erases of one present key cannot both succeed.
+    const std::vector<operation> double_erase{
+        {7, 0, 1, operation_kind::insert, true},
+        {7, 2, 5, operation_kind::erase, true},
+        {7, 3, 4, operation_kind::erase, true},
+    };
+    EXPECT_EQ(stress::find_violation(double_erase), std::optional<std::uint64_t>(7));
+}
+
+TEST(StressHarnessTest, TimedRunReportsThroughput) {
+    stress::workload w;
+    w.threads = 2;
+    w.key_range = 1024;
+    w.duration = std::chrono::milliseconds(50);
+    const stress::result r = stress::run<concurrent_skip_list<std::uint64_t>>(w);
+    EXPECT_EQ(r.threads, 2u);
+    EXPECT_GT(r.operations, 0u);
+    EXPECT_GT(r.ops_per_second(), 0.0);
+    EXPECT_EQ(r.reads.count() + r.writes.count(), r.operations);
+    EXPECT_GT(r.reads.count(), r.writes.count());
+    EXPECT_FALSE(r.checked);
+}
+
+TEST(StressHarnessTest, LockedSkipListIsLinearizable) {
+    const stress::result r = stress::run<stress::locked_set<>>(checked_workload(50, stress::key_distribution::uniform));
+    EXPECT_EQ(r.operations, 4u * 5000u);
+    EXPECT_TRUE(r.checked);
+    EXPECT_FALSE(r.violation);
+}
+
+TEST(StressHarnessTest, SingleWriterSkipListIsLinearizable) {
+    const stress::result r = stress::run<stress::single_writer_set<>>(checked_workload(50, stress::key_distribution::zipfian));
+    EXPECT_TRUE(r.checked);
+    EXPECT_FALSE(r.violation);
+}
+
+TEST(StressHarnessTest, ConcurrentSkipListIsLinearizable) {
+    for (unsigned read_percent : {95u, 50u, 0u}) {
+        const stress::result r = stress::run<concurrent_skip_list<std::uint64_t>>(checked_workload(read_percent, stress::key_distribution::uniform));
+        EXPECT_FALSE(r.violation) << read_percent << "% reads";
+    }
+    const stress::result r = stress::run<concurrent_skip_list<std::uint64_t>>(checked_workload(50, stress::key_distribution::zipfian));
+    EXPECT_FALSE(r.violation);
+}
+
+TEST(StressHarnessTest, ShardedSkipListIsLinearizable) {
+    const stress::result r = stress::run<sharded_skip_list<std::uint64_t, 4>>(checked_workload(50, stress::key_distribution::uniform));
+    EXPECT_FALSE(r.violation);
+}
+
+TEST(StressHarnessTest, CatchesRacyErase) {
+    // The race needs two erases of one key to interleave; retry a few times on a single-core machine.
+    stress::workload w = checked_workload(0, stress::key_distribution::uniform);
+    w.key_range = 2;
+    bool caught = false;
+    for (int attempt = 0; attempt < 10 && !caught; ++attempt) {
+        w.seed = static_cast<std::uint64_t>(attempt);
+        caught = stress::run<racy_set>(w).violation.has_value();
+    }
+    EXPECT_TRUE(caught);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,166 @@
+#include "gtest/gtest.h"
+#include "unrolled_skip_list.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+/// Checks the contents and the result of every lookup around the stored keys against a reference.
+template<typename List, typename Set>
+void ExpectSameSet(const List& list, const Set& reference) {
+    using key_type = typename List::key_type;
+    ASSERT_EQ(list.size(), reference.size());
+    ASSERT_TRUE(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    for (key_type key : reference) {
+        ASSERT_TRUE(list.contains(key));
+        ASSERT_EQ(*list.find(key), key);
+        for (key_type probe : {static_cast<key_type>(key - 1), static_cast<key_type>(key + 1)}) {
+            ASSERT_EQ(list.contains(probe), reference.contains(probe));
+            const auto lower = reference.lower_bound(probe);
+            ASSERT_EQ(list.lower_bound(probe) == list.end(), lower == reference.end());
+            if (lower != reference.end()) {
+                ASSERT_EQ(*list.lower_bound(probe), *lower);
+            }
+            const auto upper = reference.upper_bound(probe);
+            ASSERT_EQ(list.upper_bound(probe) == std::default_sentinel, upper == reference.end());
+        }
+    }
+}
+
+template<typename Key>
+class UnrolledSkipListTest : public ::testing::Test {};
+
+using KeyTypes = ::testing::Types<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, int, unsigned,
+                                  std::int64_t, std::uint64_t>;
+TYPED_TEST_SUITE(UnrolledSkipListTest, KeyTypes);
+
+} // namespace
+
+TYPED_TEST(UnrolledSkipListTest, RandomInsertsAndErasesMatchASet) {
+    using key_type = TypeParam;
+    std::mt19937_64 g(13);
+    unrolled_skip_list<key_type> list;
+    std::set<key_type> reference;
+    for (int round = 0; round < 6000; ++round) {
+        const auto key = static_cast<key_type>(g() >> 3);
+        if (g() % 3 == 0) {
+            ASSERT_EQ(list.erase(key), reference.erase(key) == 1);
+        } else {
+            ASSERT_EQ(list.insert(key), reference.insert(key).second);
+        }
+    }
+    ExpectSameSet(list, reference);
+}
+
+TYPED_TEST(UnrolledSkipListTest, ExtremeKeysAreNotConfusedWithPadding) {
+    using key_type = TypeParam;
+    using limits = std::numeric_limits<key_type>;
+    unrolled_skip_list<key_type> list;
+    EXPECT_FALSE(list.contains(limits::max()));
+    EXPECT_TRUE(list.insert(limits::max()));
+    EXPECT_TRUE(list.insert(limits::min()));
+    EXPECT_TRUE(list.insert(key_type{1}));
+    EXPECT_FALSE(list.insert(limits::max()));
+    EXPECT_EQ(std::vector<key_type>(list.begin(), list.end()),
+              (std::vector<key_type>{limits::min(), key_type{1}, limits::max()}));
+    EXPECT_EQ(*list.lower_bound(key_type{2}), limits::max());
+    EXPECT_EQ(list.upper_bound(limits::max()), list.end());
+    EXPECT_TRUE(list.erase(limits::max()));
+    EXPECT_FALSE(list.contains(limits::max()));
+    EXPECT_EQ(list.lower_bound(key_type{2}), list.end());
+}
+
+TEST(UnrolledSkipListTest, BlocksSplitAndMergeToStayDense) {
+    unrolled_skip_list<int> list;
+    constexpr int count = 20000;
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(list.insert(i));
+    }
+    constexpr std::size_t half = unrolled_skip_list<int>::block_capacity / 2;
+    EXPECT_LE(list.block_count(), count / half + 1);
+    for (int i = 0; i < count; ++i) {
+        if (i % 16 != 0) {
+            ASSERT_TRUE(list.erase(i));
+        }
+    }
+    EXPECT_EQ(list.size(), static_cast<std::size_t>(count / 16));
+    EXPECT_LE(list.block_count(), list.size() / 2 + 1); // Sparse neighbours were merged.
+    for (int i = 0; i < count; i += 16) {
+        ASSERT_TRUE(list.erase(i));
+    }
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.block_count(), 0u);
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_TRUE(list.insert(5));
+    EXPECT_EQ(*list.begin(), 5);
+}
+
+TEST(UnrolledSkipListTest, BlocksTakeAHeaderLineAndAKeyLine) {
+    unrolled_skip_list<int> list;
+    std::mt19937 g(5);
+    while (list.size() < 20000) {
+        list.insert(static_cast<int>(g()));
+    }
+    const skip_list_memory_usage usage = list.memory_usage();
+    EXPECT_EQ(usage.container, sizeof(list));
+    EXPECT_GE(usage.nodes + usage.towers, list.block_count() * 128);
+    EXPECT_LT(usage.nodes + usage.towers, list.block_count() * 136); // Only towers past 7 levels take a third line.
+    EXPECT_LT(static_cast<double>(usage.total()) / static_cast<double>(list.size()), 16.0);
+
+    // Erasing the smallest key of every block keeps the separator copies in the headers right.
+    std::vector<int> keys(list.begin(), list.end());
+    for (std::size_t i = 0; i < keys.size(); i += 3) {
+        ASSERT_TRUE(list.erase(keys[i]));
+    }
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(list.contains(keys[i]), i % 3 != 0);
+    }
+    list.clear();
+    EXPECT_EQ(list.memory_usage().nodes, 0u);
+}
+
+TEST(UnrolledSkipListTest, OtherOrderingsUseTheScalarRank) {
+    const std::vector<long long> keys{5, -3, 9, 1, 7, 5, 100, -50};
+    unrolled_skip_list<long long, std::greater<long long>> list(keys.begin(), keys.end());
+    std::set<long long, std::greater<long long>> reference(keys.begin(), keys.end());
+    ExpectSameSet(list, reference);
+
+    unrolled_skip_list<double> doubles;
+    for (int i = 0; i < 500; ++i) {
+        doubles.insert(i * 0.5);
+    }
+    EXPECT_TRUE(doubles.contains(12.5));
+    EXPECT_FALSE(doubles.contains(12.25));
+    EXPECT_EQ(*doubles.lower_bound(12.25), 12.5);
+}
+
+TEST(UnrolledSkipListTest, CopiesAndMovesAreIndependent) {
+    unrolled_skip_list<std::uint64_t> list;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        list.insert(i * 7);
+    }
+    unrolled_skip_list<std::uint64_t> copy(list);
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), list.begin(), list.end()));
+    copy.erase(7);
+    EXPECT_TRUE(list.contains(7));
+    unrolled_skip_list<std::uint64_t> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 1000u);
+    list = moved;
+    moved.clear();
+    EXPECT_EQ(list.size(), 1000u);
+    EXPECT_TRUE(list.contains(6993));
+    swap(list, moved);
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(moved.contains(6993));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}